@@ -32,23 +32,28 @@ namespace cl
 
 /// \brief Generic atomic class
 ///
-/// Please note that arithmetic operations are only provided for integral atomic types
+/// Please note that arithmetic operations are only provided for integral atomic types, floating point atomic types provide only fetch_add,
+/// fetch_sub, fetch_min, fetch_max, operator+= and operator-=
 template <typename T>
 struct atomic : public conditional_t<
     __details::__is_atomic_integer_type<T>::value,
     __details::__atomic_arithmetic_capable<T, typename __details::__atomic_types<T>::spirv_type>,
-    __details::__atomic_base<T, typename __details::__atomic_types<T>::spirv_type >>
+    conditional_t<__details::__is_atomic_floating_type<T>::value,
+    __details::__atomic_floating_capable<T, typename __details::__atomic_types<T>::spirv_type>,
+    __details::__atomic_base<T, typename __details::__atomic_types<T>::spirv_type >>>
 {
     using __base = conditional_t<
     __details::__is_atomic_integer_type<T>::value,
     __details::__atomic_arithmetic_capable<T, typename __details::__atomic_types<T>::spirv_type>,
-    __details::__atomic_base<T, typename __details::__atomic_types<T>::spirv_type >>;
+    conditional_t<__details::__is_atomic_floating_type<T>::value,
+    __details::__atomic_floating_capable<T, typename __details::__atomic_types<T>::spirv_type>,
+    __details::__atomic_base<T, typename __details::__atomic_types<T>::spirv_type >>>;
     using __base::__base;
     using __base::operator=;
 
     static_assert(__details::__is_valid_atomic_type<T>::value, "The generic atomic<T> class template is only available if T is "
-        "int, uint, long, ulong, float, double, intptr_t, uintptr_t, size_t, ptrdiff_t or pointer to any type. Note that "
-        "64-bit types may require 'cl_khr_int64_base_atomics' and 'cl_khr_int64_extended_atomics' extensions and atomic<double> in addition requires 'cl_khr_fp64'.");
+        "int, uint, long, ulong, half, float, double, intptr_t, uintptr_t, size_t, ptrdiff_t or pointer to any type. Note that "
+        "64-bit types may require 'cl_khr_int64_base_atomics' and 'cl_khr_int64_extended_atomics' extensions and atomic<double> in addition requires 'cl_khr_fp64', atomic<half> requires 'cl_khr_fp16'.");
 };
 
 /// \brief Typedefs for atomic types
@@ -59,6 +64,10 @@ using atomic_uint = atomic<unsigned int>;
 using atomic_long = atomic<long>;
 using atomic_ulong = atomic<unsigned long>;
 #endif
+#if defined(cl_khr_fp16)
+/// atomic_half operates on the 32-bit word containing it, buffers of atomic_half have to be padded to a multiple of 4 bytes
+using atomic_half = atomic<half>;
+#endif
 using atomic_float = atomic<float>;
 #if defined(cl_khr_fp64) && defined(cl_khr_int64_base_atomics) && defined(cl_khr_int64_extended_atomics)
 using atomic_double = atomic<double>;
@@ -74,6 +83,83 @@ using atomic_size_t = atomic<size_t>;
 using atomic_ptrdiff_t = atomic<ptrdiff_t>;
 #endif
 
+/// \brief Atomic view of an object which is not declared as atomic
+///
+/// The referenced object can live in any address space, all accesses to it have to be made through atomic_ref as long as
+/// any atomic_ref referencing it exists. Order and Scope are used by default by every operation. Operations are lowered
+/// directly on the referenced object the same way as for atomic<T>, arithmetic operations are available if atomic<T> provides them.
+/// atomic_ref<half> operates on the 32-bit word containing the referenced half, so its buffer has to be padded to a multiple of 4 bytes.
+template <typename T, memory_order Order = memory_order_seq_cst, memory_scope Scope = memory_scope_device>
+struct atomic_ref
+{
+    static_assert(__details::__is_valid_atomic_type<T>::value, "atomic_ref<T> is only available for types which can be used with atomic<T>.");
+
+    typedef T value_type;
+    typedef conditional_t<is_pointer<T>::value, ptrdiff_t, T> difference_type;
+
+    static constexpr size_t required_alignment = alignof(T);
+
+    explicit atomic_ref(T& obj) __NOEXCEPT : __ptr(__builtin_addressof(obj)) { }
+    atomic_ref(const atomic_ref&) __NOEXCEPT = default;
+    atomic_ref& operator=(const atomic_ref&) = delete;
+
+    __ALWAYS_INLINE T load(memory_order order = Order, memory_scope scope = Scope) const __NOEXCEPT { return __ops::__load(__ptr, order, scope); }
+    __ALWAYS_INLINE void store(T value, memory_order order = Order, memory_scope scope = Scope) const __NOEXCEPT { __ops::__store(__ptr, value, order, scope); }
+    __ALWAYS_INLINE T exchange(T value, memory_order order = Order, memory_scope scope = Scope) const __NOEXCEPT { return __ops::__exchange(__ptr, value, order, scope); }
+
+    __ALWAYS_INLINE bool compare_exchange_weak(T& expected, T value, memory_order order = Order, memory_scope scope = Scope) const __NOEXCEPT { return __ops::__compare_exchange_weak(__ptr, expected, value, order, order, scope); }
+    __ALWAYS_INLINE bool compare_exchange_weak(T& expected, T value, memory_order success, memory_order failure, memory_scope scope = Scope) const __NOEXCEPT { return __ops::__compare_exchange_weak(__ptr, expected, value, success, failure, scope); }
+    __ALWAYS_INLINE bool compare_exchange_strong(T& expected, T value, memory_order order = Order, memory_scope scope = Scope) const __NOEXCEPT { return __ops::__compare_exchange_strong(__ptr, expected, value, order, order, scope); }
+    __ALWAYS_INLINE bool compare_exchange_strong(T& expected, T value, memory_order success, memory_order failure, memory_scope scope = Scope) const __NOEXCEPT { return __ops::__compare_exchange_strong(__ptr, expected, value, success, failure, scope); }
+
+#define ATOMIC_REF_OPERATION(name, trait, op) \
+    template <typename U = T> \
+    __ALWAYS_INLINE enable_if_t<__details::trait<U>::value, T> fetch_##name(difference_type value, memory_order order = Order, memory_scope scope = Scope) const __NOEXCEPT \
+    { return __ops::op(__ptr, value, order, scope); }
+
+    ATOMIC_REF_OPERATION(add, __is_atomic_integer_type, __fetch_add)
+    ATOMIC_REF_OPERATION(sub, __is_atomic_integer_type, __fetch_sub)
+    ATOMIC_REF_OPERATION(and, __is_atomic_integer_type, __fetch_and)
+    ATOMIC_REF_OPERATION(or, __is_atomic_integer_type, __fetch_or)
+    ATOMIC_REF_OPERATION(xor, __is_atomic_integer_type, __fetch_xor)
+    ATOMIC_REF_OPERATION(min, __is_atomic_integer_type, __fetch_min)
+    ATOMIC_REF_OPERATION(max, __is_atomic_integer_type, __fetch_max)
+
+    ATOMIC_REF_OPERATION(add, __is_atomic_floating_type, __fetch_fadd)
+    ATOMIC_REF_OPERATION(sub, __is_atomic_floating_type, __fetch_fsub)
+    ATOMIC_REF_OPERATION(min, __is_atomic_floating_type, __fetch_fmin)
+    ATOMIC_REF_OPERATION(max, __is_atomic_floating_type, __fetch_fmax)
+
+#undef ATOMIC_REF_OPERATION
+
+    __ALWAYS_INLINE operator T() const __NOEXCEPT { return load(); }
+    __ALWAYS_INLINE T operator=(T value) const __NOEXCEPT { store(value); return value; }
+
+    template <typename U = T>
+    __ALWAYS_INLINE enable_if_t<__details::__is_atomic_integer_type<U>::value || __details::__is_atomic_floating_type<U>::value, T> operator+=(difference_type value) const __NOEXCEPT { return fetch_add(value) + value; }
+    template <typename U = T>
+    __ALWAYS_INLINE enable_if_t<__details::__is_atomic_integer_type<U>::value || __details::__is_atomic_floating_type<U>::value, T> operator-=(difference_type value) const __NOEXCEPT { return fetch_sub(value) - value; }
+
+    template <typename U = T>
+    __ALWAYS_INLINE enable_if_t<__details::__is_atomic_integer_type<U>::value, T> operator++(int) const __NOEXCEPT { return fetch_add(1); }
+    template <typename U = T>
+    __ALWAYS_INLINE enable_if_t<__details::__is_atomic_integer_type<U>::value, T> operator--(int) const __NOEXCEPT { return fetch_sub(1); }
+    template <typename U = T>
+    __ALWAYS_INLINE enable_if_t<__details::__is_atomic_integer_type<U>::value, T> operator++() const __NOEXCEPT { return fetch_add(1) + 1; }
+    template <typename U = T>
+    __ALWAYS_INLINE enable_if_t<__details::__is_atomic_integer_type<U>::value, T> operator--() const __NOEXCEPT { return fetch_sub(1) - 1; }
+
+private:
+    typedef __details::__atomic_ops<T, typename __details::__atomic_types<T>::spirv_type> __ops;
+
+    T* __ptr;
+};
+
+/// \brief Creates atomic_ref referencing obj
+///
+template <memory_order Order = memory_order_seq_cst, memory_scope Scope = memory_scope_device, typename T>
+__ALWAYS_INLINE atomic_ref<T, Order, Scope> make_atomic_ref(T& obj) __NOEXCEPT { return atomic_ref<T, Order, Scope>(obj); }
+
 #define ATOMIC_FLAG_INIT {0}
 
 /// \brief Atomic flag class
@@ -132,10 +218,10 @@ template <class T> __ALWAYS_INLINE auto atomic_compare_exchange_weak(volatile at
 template <class T> __ALWAYS_INLINE auto atomic_compare_exchange_weak_explicit(atomic<T>* object, T* expected, T desired, _MEM_ORD2) __NOEXCEPT -> decltype(object->compare_exchange_weak(*expected, desired, success, failure, scope)) { return object->compare_exchange_weak(*expected, desired, success, failure, scope); }
 template <class T> __ALWAYS_INLINE auto atomic_compare_exchange_weak_explicit(volatile atomic<T>* object, T* expected, T desired, _MEM_ORD2) __NOEXCEPT -> decltype(object->compare_exchange_weak(*expected, desired, success, failure, scope)) { return object->compare_exchange_weak(*expected, desired, success, failure, scope); }
 
-template <class T> __ALWAYS_INLINE auto atomic_fetch_add(atomic<T>* object, T value) __NOEXCEPT -> decltype(object->fetch_add(value)) { static_assert(__details::__is_atomic_integer_type<T>::value, "Arithemetic operations are supported only for integer type atomics"); return object->fetch_add(value); }
-template <class T> __ALWAYS_INLINE auto atomic_fetch_add(volatile atomic<T>* object, T value) __NOEXCEPT -> decltype(object->fetch_add(value)) { static_assert(__details::__is_atomic_integer_type<T>::value, "Arithemetic operations are supported only for integer type atomics"); return object->fetch_add(value); }
-template <class T> __ALWAYS_INLINE auto atomic_fetch_add_explicit(atomic<T>* object, T value, _MEM_ORD) __NOEXCEPT -> decltype(object->fetch_add(value, order, scope)) { static_assert(__details::__is_atomic_integer_type<T>::value, "Arithemetic operations are supported only for integer type atomics"); return object->fetch_add(value, order, scope); }
-template <class T> __ALWAYS_INLINE auto atomic_fetch_add_explicit(volatile atomic<T>* object, T value, _MEM_ORD) __NOEXCEPT -> decltype(object->fetch_add(value, order, scope)) { static_assert(__details::__is_atomic_integer_type<T>::value, "Arithemetic operations are supported only for integer type atomics"); return object->fetch_add(value, order, scope); }
+template <class T> __ALWAYS_INLINE auto atomic_fetch_add(atomic<T>* object, T value) __NOEXCEPT -> decltype(object->fetch_add(value)) { static_assert(__details::__is_atomic_integer_type<T>::value || __details::__is_atomic_floating_type<T>::value, "Arithemetic operations are supported only for integer and floating point type atomics"); return object->fetch_add(value); }
+template <class T> __ALWAYS_INLINE auto atomic_fetch_add(volatile atomic<T>* object, T value) __NOEXCEPT -> decltype(object->fetch_add(value)) { static_assert(__details::__is_atomic_integer_type<T>::value || __details::__is_atomic_floating_type<T>::value, "Arithemetic operations are supported only for integer and floating point type atomics"); return object->fetch_add(value); }
+template <class T> __ALWAYS_INLINE auto atomic_fetch_add_explicit(atomic<T>* object, T value, _MEM_ORD) __NOEXCEPT -> decltype(object->fetch_add(value, order, scope)) { static_assert(__details::__is_atomic_integer_type<T>::value || __details::__is_atomic_floating_type<T>::value, "Arithemetic operations are supported only for integer and floating point type atomics"); return object->fetch_add(value, order, scope); }
+template <class T> __ALWAYS_INLINE auto atomic_fetch_add_explicit(volatile atomic<T>* object, T value, _MEM_ORD) __NOEXCEPT -> decltype(object->fetch_add(value, order, scope)) { static_assert(__details::__is_atomic_integer_type<T>::value || __details::__is_atomic_floating_type<T>::value, "Arithemetic operations are supported only for integer and floating point type atomics"); return object->fetch_add(value, order, scope); }
 template <class T> __ALWAYS_INLINE auto atomic_fetch_and(atomic<T>* object, T value) __NOEXCEPT -> decltype(object->fetch_and(value)) { static_assert(__details::__is_atomic_integer_type<T>::value, "Arithemetic operations are supported only for integer type atomics"); return object->fetch_and(value); }
 template <class T> __ALWAYS_INLINE auto atomic_fetch_and(volatile atomic<T>* object, T value) __NOEXCEPT -> decltype(object->fetch_and(value)) { static_assert(__details::__is_atomic_integer_type<T>::value, "Arithemetic operations are supported only for integer type atomics"); return object->fetch_and(value); }
 template <class T> __ALWAYS_INLINE auto atomic_fetch_and_explicit(atomic<T>* object, T value, _MEM_ORD) __NOEXCEPT -> decltype(object->fetch_and(value, order, scope)) { static_assert(__details::__is_atomic_integer_type<T>::value, "Arithemetic operations are supported only for integer type atomics"); return object->fetch_and(value, order, scope); }
@@ -144,22 +230,22 @@ template <class T> __ALWAYS_INLINE auto atomic_fetch_or(atomic<T>* object, T val
 template <class T> __ALWAYS_INLINE auto atomic_fetch_or(volatile atomic<T>* object, T value) __NOEXCEPT -> decltype(object->fetch_or(value)) { static_assert(__details::__is_atomic_integer_type<T>::value, "Arithemetic operations are supported only for integer type atomics"); return object->fetch_or(value); }
 template <class T> __ALWAYS_INLINE auto atomic_fetch_or_explicit(atomic<T>* object, T value, _MEM_ORD) __NOEXCEPT -> decltype(object->fetch_or(value, order, scope)) { static_assert(__details::__is_atomic_integer_type<T>::value, "Arithemetic operations are supported only for integer type atomics"); return object->fetch_or(value, order, scope); }
 template <class T> __ALWAYS_INLINE auto atomic_fetch_or_explicit(volatile atomic<T>* object, T value, _MEM_ORD) __NOEXCEPT -> decltype(object->fetch_or(value, order, scope)) { static_assert(__details::__is_atomic_integer_type<T>::value, "Arithemetic operations are supported only for integer type atomics"); return object->fetch_or(value, order, scope); }
-template <class T> __ALWAYS_INLINE auto atomic_fetch_sub(atomic<T>* object, T value) __NOEXCEPT -> decltype(object->fetch_sub(value)) { static_assert(__details::__is_atomic_integer_type<T>::value, "Arithemetic operations are supported only for integer type atomics"); return object->fetch_sub(value); }
-template <class T> __ALWAYS_INLINE auto atomic_fetch_sub(volatile atomic<T>* object, T value) __NOEXCEPT -> decltype(object->fetch_sub(value)) { static_assert(__details::__is_atomic_integer_type<T>::value, "Arithemetic operations are supported only for integer type atomics"); return object->fetch_sub(value); }
-template <class T> __ALWAYS_INLINE auto atomic_fetch_sub_explicit(atomic<T>* object, T value, _MEM_ORD) __NOEXCEPT -> decltype(object->fetch_sub(value, order, scope)) { static_assert(__details::__is_atomic_integer_type<T>::value, "Arithemetic operations are supported only for integer type atomics"); return object->fetch_sub(value, order, scope); }
-template <class T> __ALWAYS_INLINE auto atomic_fetch_sub_explicit(volatile atomic<T>* object, T value, _MEM_ORD) __NOEXCEPT -> decltype(object->fetch_sub(value, order, scope)) { static_assert(__details::__is_atomic_integer_type<T>::value, "Arithemetic operations are supported only for integer type atomics"); return object->fetch_sub(value, order, scope); }
+template <class T> __ALWAYS_INLINE auto atomic_fetch_sub(atomic<T>* object, T value) __NOEXCEPT -> decltype(object->fetch_sub(value)) { static_assert(__details::__is_atomic_integer_type<T>::value || __details::__is_atomic_floating_type<T>::value, "Arithemetic operations are supported only for integer and floating point type atomics"); return object->fetch_sub(value); }
+template <class T> __ALWAYS_INLINE auto atomic_fetch_sub(volatile atomic<T>* object, T value) __NOEXCEPT -> decltype(object->fetch_sub(value)) { static_assert(__details::__is_atomic_integer_type<T>::value || __details::__is_atomic_floating_type<T>::value, "Arithemetic operations are supported only for integer and floating point type atomics"); return object->fetch_sub(value); }
+template <class T> __ALWAYS_INLINE auto atomic_fetch_sub_explicit(atomic<T>* object, T value, _MEM_ORD) __NOEXCEPT -> decltype(object->fetch_sub(value, order, scope)) { static_assert(__details::__is_atomic_integer_type<T>::value || __details::__is_atomic_floating_type<T>::value, "Arithemetic operations are supported only for integer and floating point type atomics"); return object->fetch_sub(value, order, scope); }
+template <class T> __ALWAYS_INLINE auto atomic_fetch_sub_explicit(volatile atomic<T>* object, T value, _MEM_ORD) __NOEXCEPT -> decltype(object->fetch_sub(value, order, scope)) { static_assert(__details::__is_atomic_integer_type<T>::value || __details::__is_atomic_floating_type<T>::value, "Arithemetic operations are supported only for integer and floating point type atomics"); return object->fetch_sub(value, order, scope); }
 template <class T> __ALWAYS_INLINE auto atomic_fetch_xor(atomic<T>* object, T value) __NOEXCEPT -> decltype(object->fetch_xor(value)) { static_assert(__details::__is_atomic_integer_type<T>::value, "Arithemetic operations are supported only for integer type atomics"); return object->fetch_xor(value); }
 template <class T> __ALWAYS_INLINE auto atomic_fetch_xor(volatile atomic<T>* object, T value) __NOEXCEPT -> decltype(object->fetch_xor(value)) { static_assert(__details::__is_atomic_integer_type<T>::value, "Arithemetic operations are supported only for integer type atomics"); return object->fetch_xor(value); }
 template <class T> __ALWAYS_INLINE auto atomic_fetch_xor_explicit(atomic<T>* object, T value, _MEM_ORD) __NOEXCEPT -> decltype(object->fetch_xor(value, order, scope)) { static_assert(__details::__is_atomic_integer_type<T>::value, "Arithemetic operations are supported only for integer type atomics"); return object->fetch_xor(value, order, scope); }
 template <class T> __ALWAYS_INLINE auto atomic_fetch_xor_explicit(volatile atomic<T>* object, T value, _MEM_ORD) __NOEXCEPT -> decltype(object->fetch_xor(value, order, scope)) { static_assert(__details::__is_atomic_integer_type<T>::value, "Arithemetic operations are supported only for integer type atomics"); return object->fetch_xor(value, order, scope); }
-template <class T> __ALWAYS_INLINE auto atomic_fetch_min(atomic<T>* object, T value) __NOEXCEPT -> decltype(object->fetch_min(value)) { static_assert(__details::__is_atomic_integer_type<T>::value, "Arithemetic operations are supported only for integer type atomics"); return object->fetch_min(value); }
-template <class T> __ALWAYS_INLINE auto atomic_fetch_min(volatile atomic<T>* object, T value) __NOEXCEPT -> decltype(object->fetch_min(value)) { static_assert(__details::__is_atomic_integer_type<T>::value, "Arithemetic operations are supported only for integer type atomics"); return object->fetch_min(value); }
-template <class T> __ALWAYS_INLINE auto atomic_fetch_min_explicit(atomic<T>* object, T value, _MEM_ORD) __NOEXCEPT -> decltype(object->fetch_min(value, order, scope)) { static_assert(__details::__is_atomic_integer_type<T>::value, "Arithemetic operations are supported only for integer type atomics"); return object->fetch_min(value, order, scope); }
-template <class T> __ALWAYS_INLINE auto atomic_fetch_min_explicit(volatile atomic<T>* object, T value, _MEM_ORD) __NOEXCEPT -> decltype(object->fetch_min(value, order, scope)) { static_assert(__details::__is_atomic_integer_type<T>::value, "Arithemetic operations are supported only for integer type atomics"); return object->fetch_min(value, order, scope); }
-template <class T> __ALWAYS_INLINE auto atomic_fetch_max(atomic<T>* object, T value) __NOEXCEPT -> decltype(object->fetch_max(value)) { static_assert(__details::__is_atomic_integer_type<T>::value, "Arithemetic operations are supported only for integer type atomics"); return object->fetch_max(value); }
-template <class T> __ALWAYS_INLINE auto atomic_fetch_max(volatile atomic<T>* object, T value) __NOEXCEPT -> decltype(object->fetch_max(value)) { static_assert(__details::__is_atomic_integer_type<T>::value, "Arithemetic operations are supported only for integer type atomics"); return object->fetch_max(value); }
-template <class T> __ALWAYS_INLINE auto atomic_fetch_max_explicit(atomic<T>* object, T value, _MEM_ORD) __NOEXCEPT -> decltype(object->fetch_max(value, order, scope)) { static_assert(__details::__is_atomic_integer_type<T>::value, "Arithemetic operations are supported only for integer type atomics"); return object->fetch_max(value, order, scope); }
-template <class T> __ALWAYS_INLINE auto atomic_fetch_max_explicit(volatile atomic<T>* object, T value, _MEM_ORD) __NOEXCEPT -> decltype(object->fetch_max(value, order, scope)) { static_assert(__details::__is_atomic_integer_type<T>::value, "Arithemetic operations are supported only for integer type atomics"); return object->fetch_max(value, order, scope); }
+template <class T> __ALWAYS_INLINE auto atomic_fetch_min(atomic<T>* object, T value) __NOEXCEPT -> decltype(object->fetch_min(value)) { static_assert(__details::__is_atomic_integer_type<T>::value || __details::__is_atomic_floating_type<T>::value, "Arithemetic operations are supported only for integer and floating point type atomics"); return object->fetch_min(value); }
+template <class T> __ALWAYS_INLINE auto atomic_fetch_min(volatile atomic<T>* object, T value) __NOEXCEPT -> decltype(object->fetch_min(value)) { static_assert(__details::__is_atomic_integer_type<T>::value || __details::__is_atomic_floating_type<T>::value, "Arithemetic operations are supported only for integer and floating point type atomics"); return object->fetch_min(value); }
+template <class T> __ALWAYS_INLINE auto atomic_fetch_min_explicit(atomic<T>* object, T value, _MEM_ORD) __NOEXCEPT -> decltype(object->fetch_min(value, order, scope)) { static_assert(__details::__is_atomic_integer_type<T>::value || __details::__is_atomic_floating_type<T>::value, "Arithemetic operations are supported only for integer and floating point type atomics"); return object->fetch_min(value, order, scope); }
+template <class T> __ALWAYS_INLINE auto atomic_fetch_min_explicit(volatile atomic<T>* object, T value, _MEM_ORD) __NOEXCEPT -> decltype(object->fetch_min(value, order, scope)) { static_assert(__details::__is_atomic_integer_type<T>::value || __details::__is_atomic_floating_type<T>::value, "Arithemetic operations are supported only for integer and floating point type atomics"); return object->fetch_min(value, order, scope); }
+template <class T> __ALWAYS_INLINE auto atomic_fetch_max(atomic<T>* object, T value) __NOEXCEPT -> decltype(object->fetch_max(value)) { static_assert(__details::__is_atomic_integer_type<T>::value || __details::__is_atomic_floating_type<T>::value, "Arithemetic operations are supported only for integer and floating point type atomics"); return object->fetch_max(value); }
+template <class T> __ALWAYS_INLINE auto atomic_fetch_max(volatile atomic<T>* object, T value) __NOEXCEPT -> decltype(object->fetch_max(value)) { static_assert(__details::__is_atomic_integer_type<T>::value || __details::__is_atomic_floating_type<T>::value, "Arithemetic operations are supported only for integer and floating point type atomics"); return object->fetch_max(value); }
+template <class T> __ALWAYS_INLINE auto atomic_fetch_max_explicit(atomic<T>* object, T value, _MEM_ORD) __NOEXCEPT -> decltype(object->fetch_max(value, order, scope)) { static_assert(__details::__is_atomic_integer_type<T>::value || __details::__is_atomic_floating_type<T>::value, "Arithemetic operations are supported only for integer and floating point type atomics"); return object->fetch_max(value, order, scope); }
+template <class T> __ALWAYS_INLINE auto atomic_fetch_max_explicit(volatile atomic<T>* object, T value, _MEM_ORD) __NOEXCEPT -> decltype(object->fetch_max(value, order, scope)) { static_assert(__details::__is_atomic_integer_type<T>::value || __details::__is_atomic_floating_type<T>::value, "Arithemetic operations are supported only for integer and floating point type atomics"); return object->fetch_max(value, order, scope); }
 
 template <class T> __ALWAYS_INLINE auto atomic_fetch_add(atomic<T*>* object, ptrdiff_t value) __NOEXCEPT -> decltype(object->fetch_add(value)) { static_assert(__details::__is_atomic_integer_type<T>::value, "Arithemetic operations are supported only for integer type atomics"); return object->fetch_add(value); }
 template <class T> __ALWAYS_INLINE auto atomic_fetch_add(volatile atomic<T*>* object, ptrdiff_t value) __NOEXCEPT -> decltype(object->fetch_add(value)) { static_assert(__details::__is_atomic_integer_type<T>::value, "Arithemetic operations are supported only for integer type atomics"); return object->fetch_add(value); }
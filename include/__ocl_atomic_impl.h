@@ -42,44 +42,203 @@ namespace __details
 ///
 #define _MEM_ORD2 memory_order success, memory_order failure, memory_scope scope = memory_scope_device
 
+/// \brief Binary operations used by emulated floating point atomics
+///
+struct __atomic_add_op { template <class T> __ALWAYS_INLINE T operator()(T x, T y) const __NOEXCEPT { return x + y; } };
+struct __atomic_sub_op { template <class T> __ALWAYS_INLINE T operator()(T x, T y) const __NOEXCEPT { return x - y; } };
+struct __atomic_min_op { template <class T> __ALWAYS_INLINE T operator()(T x, T y) const __NOEXCEPT { return y < x ? y : x; } };
+struct __atomic_max_op { template <class T> __ALWAYS_INLINE T operator()(T x, T y) const __NOEXCEPT { return x < y ? y : x; } };
+
+/// \brief Replaces value x stored at p with op(x, value) using load and weak compare exchange of Ops, returns x
+///
+/// The exchange is made even if op doesn't change the value, so the operation always synchronizes with requested memory order.
+template <class Ops, class T, class BinaryOp>
+__ALWAYS_INLINE T __fetch_update(volatile T* p, BinaryOp op, T value, memory_order order, memory_scope scope) __NOEXCEPT
+{
+    T expected = Ops::__load(p, memory_order_relaxed, scope);
+    while (!Ops::__compare_exchange_weak(p, expected, op(expected, value), order, memory_order_relaxed, scope)) { }
+    return expected;
+}
+
+/// \brief Atomic operations on object of type T given by pointer, lowered to SPIRV atomics operating on _SPIRV_T
+///
+/// Shared by atomic<T> and atomic_ref<T>, so the referenced object never has to be reinterpreted as atomic<T>.
+/// Integer operations are available only for integer-type atomics and floating point operations only for floating point type atomics.
+template <typename T, typename _SPIRV_T = T>
+struct __atomic_ops
+{
+    static_assert(sizeof(T) == sizeof(_SPIRV_T), "SPIRV atomic type should have same size as T");
+
+    __ALWAYS_INLINE static T __load(const volatile T* p, memory_order order, memory_scope scope) __NOEXCEPT { return __asT(__spirv::OpAtomicLoad((_SPIRV_T*)p, scope, order)); }
+    __ALWAYS_INLINE static void __store(volatile T* p, T value, memory_order order, memory_scope scope) __NOEXCEPT { __spirv::OpAtomicStore((_SPIRV_T*)p, scope, order, __asSPIRV(value)); }
+    __ALWAYS_INLINE static T __exchange(volatile T* p, T value, memory_order order, memory_scope scope) __NOEXCEPT { return __asT(__spirv::OpAtomicExchange((_SPIRV_T*)p, scope, order, __asSPIRV(value))); }
+
+    __ALWAYS_INLINE static bool __compare_exchange_strong(volatile T* p, T& expected, T value, memory_order success, memory_order failure, memory_scope scope) __NOEXCEPT
+    {
+        _SPIRV_T org = __spirv::OpAtomicCompareExchange((_SPIRV_T*)p, scope, success, failure, __asSPIRV(value), __asSPIRV(expected));
+        bool r = org == __asSPIRV(expected);
+        if (!r) expected = __asT(org);
+        return r;
+    }
+
+    __ALWAYS_INLINE static bool __compare_exchange_weak(volatile T* p, T& expected, T value, memory_order success, memory_order failure, memory_scope scope) __NOEXCEPT
+    {
+        _SPIRV_T org = __spirv::OpAtomicCompareExchangeWeak((_SPIRV_T*)p, scope, success, failure, __asSPIRV(value), __asSPIRV(expected));
+        bool r = org == __asSPIRV(expected);
+        if (!r) expected = __asT(org);
+        return r;
+    }
+
+    template <typename V> __ALWAYS_INLINE static T __fetch_add(volatile T* p, V value, memory_order order, memory_scope scope) __NOEXCEPT { return __asT(__spirv::OpAtomicIAdd((_SPIRV_T*)p, scope, order, value)); }
+    template <typename V> __ALWAYS_INLINE static T __fetch_sub(volatile T* p, V value, memory_order order, memory_scope scope) __NOEXCEPT { return __asT(__spirv::OpAtomicISub((_SPIRV_T*)p, scope, order, value)); }
+    template <typename V> __ALWAYS_INLINE static T __fetch_and(volatile T* p, V value, memory_order order, memory_scope scope) __NOEXCEPT { return __asT(__spirv::OpAtomicAnd((_SPIRV_T*)p, scope, order, value)); }
+    template <typename V> __ALWAYS_INLINE static T __fetch_or(volatile T* p, V value, memory_order order, memory_scope scope) __NOEXCEPT { return __asT(__spirv::OpAtomicOr((_SPIRV_T*)p, scope, order, value)); }
+    template <typename V> __ALWAYS_INLINE static T __fetch_xor(volatile T* p, V value, memory_order order, memory_scope scope) __NOEXCEPT { return __asT(__spirv::OpAtomicXor((_SPIRV_T*)p, scope, order, value)); }
+    template <typename V> __ALWAYS_INLINE static T __fetch_min(volatile T* p, V value, memory_order order, memory_scope scope) __NOEXCEPT { return __fetch_min(p, value, order, scope, is_unsigned<T>()); }
+    template <typename V> __ALWAYS_INLINE static T __fetch_max(volatile T* p, V value, memory_order order, memory_scope scope) __NOEXCEPT { return __fetch_max(p, value, order, scope, is_unsigned<T>()); }
+
+#if defined(cl_ext_float_atomics)
+    __ALWAYS_INLINE static T __fetch_fadd(volatile T* p, T value, memory_order order, memory_scope scope) __NOEXCEPT { return __spirv::OpAtomicFAddEXT((T*)p, scope, order, value); }
+    __ALWAYS_INLINE static T __fetch_fsub(volatile T* p, T value, memory_order order, memory_scope scope) __NOEXCEPT { return __spirv::OpAtomicFAddEXT((T*)p, scope, order, -value); }
+    __ALWAYS_INLINE static T __fetch_fmin(volatile T* p, T value, memory_order order, memory_scope scope) __NOEXCEPT { return __spirv::OpAtomicFMinEXT((T*)p, scope, order, value); }
+    __ALWAYS_INLINE static T __fetch_fmax(volatile T* p, T value, memory_order order, memory_scope scope) __NOEXCEPT { return __spirv::OpAtomicFMaxEXT((T*)p, scope, order, value); }
+#else
+    __ALWAYS_INLINE static T __fetch_fadd(volatile T* p, T value, memory_order order, memory_scope scope) __NOEXCEPT { return __fetch_update<__atomic_ops>(p, __atomic_add_op(), value, order, scope); }
+    __ALWAYS_INLINE static T __fetch_fsub(volatile T* p, T value, memory_order order, memory_scope scope) __NOEXCEPT { return __fetch_update<__atomic_ops>(p, __atomic_sub_op(), value, order, scope); }
+    __ALWAYS_INLINE static T __fetch_fmin(volatile T* p, T value, memory_order order, memory_scope scope) __NOEXCEPT { return __fetch_update<__atomic_ops>(p, __atomic_min_op(), value, order, scope); }
+    __ALWAYS_INLINE static T __fetch_fmax(volatile T* p, T value, memory_order order, memory_scope scope) __NOEXCEPT { return __fetch_update<__atomic_ops>(p, __atomic_max_op(), value, order, scope); }
+#endif
+
+private:
+    template <typename V> __ALWAYS_INLINE static T __fetch_min(volatile T* p, V value, memory_order order, memory_scope scope, true_type) __NOEXCEPT { return __asT(__spirv::OpAtomicUMin((_SPIRV_T*)p, scope, order, value)); }
+    template <typename V> __ALWAYS_INLINE static T __fetch_min(volatile T* p, V value, memory_order order, memory_scope scope, false_type) __NOEXCEPT { return __asT(__spirv::OpAtomicSMin((_SPIRV_T*)p, scope, order, value)); }
+    template <typename V> __ALWAYS_INLINE static T __fetch_max(volatile T* p, V value, memory_order order, memory_scope scope, true_type) __NOEXCEPT { return __asT(__spirv::OpAtomicUMax((_SPIRV_T*)p, scope, order, value)); }
+    template <typename V> __ALWAYS_INLINE static T __fetch_max(volatile T* p, V value, memory_order order, memory_scope scope, false_type) __NOEXCEPT { return __asT(__spirv::OpAtomicSMax((_SPIRV_T*)p, scope, order, value)); }
+
+    __ALWAYS_INLINE static T const& __asT(_SPIRV_T const& S) __NOEXCEPT { return reinterpret_cast<T const&>(S); }
+
+    __ALWAYS_INLINE static _SPIRV_T const& __asSPIRV(T const& t) __NOEXCEPT { return reinterpret_cast<_SPIRV_T const&>(t); }
+};
+
+#if defined(cl_khr_fp16)
+/// \brief Atomic operations on half
+///
+/// OpenCL has no 16-bit atomics, so every operation is made on the naturally aligned 32-bit word containing the half value.
+/// Loads extract the value from the atomically loaded word and modifications replace it with a compare exchange loop on the word,
+/// the other half of the word is never changed. Floating point operations are always emulated with compare exchange.
+/// Please note that the whole word is accessed, so a half value at a 4-byte aligned address has to be followed by 2 more bytes
+/// of the same allocation, i.e. buffers holding atomic half values have to be padded to a multiple of 4 bytes.
+template <>
+struct __atomic_ops<half, half>
+{
+    __ALWAYS_INLINE static half __load(const volatile half* p, memory_order order, memory_scope scope) __NOEXCEPT { return __extract(p, __spirv::OpAtomicLoad(__word(p), scope, order)); }
+    __ALWAYS_INLINE static void __store(volatile half* p, half value, memory_order order, memory_scope scope) __NOEXCEPT { __exchange(p, value, order, scope); }
+
+    __ALWAYS_INLINE static half __exchange(volatile half* p, half value, memory_order order, memory_scope scope) __NOEXCEPT
+    {
+        uint* word = __word(p);
+        uint old = __spirv::OpAtomicLoad(word, scope, memory_order_relaxed);
+        for (;;)
+        {
+            const uint org = __spirv::OpAtomicCompareExchangeWeak(word, scope, order, memory_order_relaxed, __insert(p, old, value), old);
+            if (org == old)
+                return __extract(p, old);
+            old = org;
+        }
+    }
+
+    /// \brief Fails only if the half value differs from expected, changes of the other half of the word are retried
+    ///
+    __ALWAYS_INLINE static bool __compare_exchange_strong(volatile half* p, half& expected, half value, memory_order success, memory_order failure, memory_scope scope) __NOEXCEPT
+    {
+        uint* word = __word(p);
+        uint old = __spirv::OpAtomicLoad(word, scope, failure);
+        for (;;)
+        {
+            const half current = __extract(p, old);
+            if (__bits(current) != __bits(expected))
+            {
+                expected = current;
+                return false;
+            }
+            const uint org = __spirv::OpAtomicCompareExchange(word, scope, success, failure, __insert(p, old, value), old);
+            if (org == old)
+                return true;
+            old = org;
+        }
+    }
+
+    __ALWAYS_INLINE static bool __compare_exchange_weak(volatile half* p, half& expected, half value, memory_order success, memory_order failure, memory_scope scope) __NOEXCEPT
+    {
+        return __compare_exchange_strong(p, expected, value, success, failure, scope);
+    }
+
+    __ALWAYS_INLINE static half __fetch_fadd(volatile half* p, half value, memory_order order, memory_scope scope) __NOEXCEPT { return __fetch_update<__atomic_ops>(p, __atomic_add_op(), value, order, scope); }
+    __ALWAYS_INLINE static half __fetch_fsub(volatile half* p, half value, memory_order order, memory_scope scope) __NOEXCEPT { return __fetch_update<__atomic_ops>(p, __atomic_sub_op(), value, order, scope); }
+    __ALWAYS_INLINE static half __fetch_fmin(volatile half* p, half value, memory_order order, memory_scope scope) __NOEXCEPT { return __fetch_update<__atomic_ops>(p, __atomic_min_op(), value, order, scope); }
+    __ALWAYS_INLINE static half __fetch_fmax(volatile half* p, half value, memory_order order, memory_scope scope) __NOEXCEPT { return __fetch_update<__atomic_ops>(p, __atomic_max_op(), value, order, scope); }
+
+private:
+    __ALWAYS_INLINE static uint __shift(const volatile half* p) __NOEXCEPT { return static_cast<uint>(reinterpret_cast<uintptr_t>(p) & 2) * 8; }
+
+    __ALWAYS_INLINE static uint* __word(const volatile half* p) __NOEXCEPT { return (uint*)((const volatile char*)p - (reinterpret_cast<uintptr_t>(p) & 2)); }
+
+    __ALWAYS_INLINE static ushort __bits(half h) __NOEXCEPT { return reinterpret_cast<const ushort&>(h); }
+
+    __ALWAYS_INLINE static half __extract(const volatile half* p, uint word) __NOEXCEPT
+    {
+        const ushort bits = static_cast<ushort>(word >> __shift(p));
+        return reinterpret_cast<const half&>(bits);
+    }
+
+    __ALWAYS_INLINE static uint __insert(const volatile half* p, uint word, half value) __NOEXCEPT
+    {
+        const uint shift = __shift(p);
+        return (word & ~(0xffffu << shift)) | (static_cast<uint>(__bits(value)) << shift);
+    }
+};
+#endif
+
 /// \brief Class containing base atomic operations
 ///
 /// These consist of all operations that are independent of whether the atomic type is a pointer or not
 template <typename T, typename _SPIRV_T = T>
 struct __atomic_base
 {
-    static_assert(sizeof(T) == sizeof(_SPIRV_T), "SPIRV atomic type should have same size as T");
+protected:
+    typedef __atomic_ops<T, _SPIRV_T> __ops;
 
+public:
     T _value;
 
     /// \brief Compare exchange strong overloads
     ///
-    __ALWAYS_INLINE bool compare_exchange_strong(T & expected, T value, _MEM_ORD) __NOEXCEPT { _SPIRV_T org = __spirv::OpAtomicCompareExchange((_SPIRV_T*)&_value, scope, order, order, asSPIRV(value), asSPIRV(expected)); bool r = org == asSPIRV(expected); if(!r) expected = (T)org; return r; }
-    __ALWAYS_INLINE bool compare_exchange_strong(T & expected, T value, _MEM_ORD) volatile __NOEXCEPT { _SPIRV_T org = __spirv::OpAtomicCompareExchange((_SPIRV_T*)&_value, scope, order, order, asSPIRV(value), asSPIRV(expected)); bool r = org == asSPIRV(expected); if(!r) expected = (T)org; return r; }
-    __ALWAYS_INLINE bool compare_exchange_strong(T & expected, T value, _MEM_ORD2) __NOEXCEPT { _SPIRV_T org = __spirv::OpAtomicCompareExchange((_SPIRV_T*)&_value, scope, success, failure, asSPIRV(value), asSPIRV(expected)); bool r = org == asSPIRV(expected); if(!r) expected = (T)org; return r; }
-    __ALWAYS_INLINE bool compare_exchange_strong(T & expected, T value, _MEM_ORD2) volatile __NOEXCEPT { _SPIRV_T org = __spirv::OpAtomicCompareExchange((_SPIRV_T*)&_value, scope, success, failure, asSPIRV(value), asSPIRV(expected)); bool r = org == asSPIRV(expected); if(!r) expected = (T)org; return r; }
+    __ALWAYS_INLINE bool compare_exchange_strong(T & expected, T value, _MEM_ORD) __NOEXCEPT { return __ops::__compare_exchange_strong(&_value, expected, value, order, order, scope); }
+    __ALWAYS_INLINE bool compare_exchange_strong(T & expected, T value, _MEM_ORD) volatile __NOEXCEPT { return __ops::__compare_exchange_strong(&_value, expected, value, order, order, scope); }
+    __ALWAYS_INLINE bool compare_exchange_strong(T & expected, T value, _MEM_ORD2) __NOEXCEPT { return __ops::__compare_exchange_strong(&_value, expected, value, success, failure, scope); }
+    __ALWAYS_INLINE bool compare_exchange_strong(T & expected, T value, _MEM_ORD2) volatile __NOEXCEPT { return __ops::__compare_exchange_strong(&_value, expected, value, success, failure, scope); }
 
     /// \brief Compare exchange weak overloads
     ///
-    __ALWAYS_INLINE bool compare_exchange_weak(T & expected, T value, _MEM_ORD) __NOEXCEPT { _SPIRV_T org = __spirv::OpAtomicCompareExchangeWeak((_SPIRV_T*)&_value, scope, order, order, asSPIRV(value), asSPIRV(expected)); bool r = org == asSPIRV(expected); if(!r) expected = (T)org; return r; }
-    __ALWAYS_INLINE bool compare_exchange_weak(T & expected, T value, _MEM_ORD) volatile __NOEXCEPT { _SPIRV_T org = __spirv::OpAtomicCompareExchangeWeak((_SPIRV_T*)&_value, scope, order, order, asSPIRV(value), asSPIRV(expected)); bool r = org == asSPIRV(expected); if(!r) expected = (T)org; return r; }
-    __ALWAYS_INLINE bool compare_exchange_weak(T & expected, T value, _MEM_ORD2) __NOEXCEPT { _SPIRV_T org = __spirv::OpAtomicCompareExchangeWeak((_SPIRV_T*)&_value, scope, success, failure, asSPIRV(value), asSPIRV(expected)); bool r = org == asSPIRV(expected); if(!r) expected = (T)org; return r; }
-    __ALWAYS_INLINE bool compare_exchange_weak(T & expected, T value, _MEM_ORD2) volatile __NOEXCEPT { _SPIRV_T org = __spirv::OpAtomicCompareExchangeWeak((_SPIRV_T*)&_value, scope, success, failure, asSPIRV(value), asSPIRV(expected)); bool r = org == asSPIRV(expected); if(!r) expected = (T)org; return r; }
+    __ALWAYS_INLINE bool compare_exchange_weak(T & expected, T value, _MEM_ORD) __NOEXCEPT { return __ops::__compare_exchange_weak(&_value, expected, value, order, order, scope); }
+    __ALWAYS_INLINE bool compare_exchange_weak(T & expected, T value, _MEM_ORD) volatile __NOEXCEPT { return __ops::__compare_exchange_weak(&_value, expected, value, order, order, scope); }
+    __ALWAYS_INLINE bool compare_exchange_weak(T & expected, T value, _MEM_ORD2) __NOEXCEPT { return __ops::__compare_exchange_weak(&_value, expected, value, success, failure, scope); }
+    __ALWAYS_INLINE bool compare_exchange_weak(T & expected, T value, _MEM_ORD2) volatile __NOEXCEPT { return __ops::__compare_exchange_weak(&_value, expected, value, success, failure, scope); }
 
     /// \brief Exchange overloads
     ///
-    __ALWAYS_INLINE T exchange(T value, _MEM_ORD) __NOEXCEPT { return asT(__spirv::OpAtomicExchange((_SPIRV_T*)&_value, scope, order, asSPIRV(value))); }
-    __ALWAYS_INLINE T exchange(T value, _MEM_ORD) volatile __NOEXCEPT { return asT(__spirv::OpAtomicExchange((_SPIRV_T*)&_value, scope, order, asSPIRV(value))); }
+    __ALWAYS_INLINE T exchange(T value, _MEM_ORD) __NOEXCEPT { return __ops::__exchange(&_value, value, order, scope); }
+    __ALWAYS_INLINE T exchange(T value, _MEM_ORD) volatile __NOEXCEPT { return __ops::__exchange(&_value, value, order, scope); }
 
     /// \brief Load overloads
     ///
-    __ALWAYS_INLINE T load(_MEM_ORD) const __NOEXCEPT { return asT(__spirv::OpAtomicLoad((_SPIRV_T*)&_value, scope, order)); }
-    __ALWAYS_INLINE T load(_MEM_ORD) const volatile __NOEXCEPT { return asT(__spirv::OpAtomicLoad((_SPIRV_T*)&_value, scope, order)); }
+    __ALWAYS_INLINE T load(_MEM_ORD) const __NOEXCEPT { return __ops::__load(&_value, order, scope); }
+    __ALWAYS_INLINE T load(_MEM_ORD) const volatile __NOEXCEPT { return __ops::__load(&_value, order, scope); }
 
     /// \brief Store overloads
     ///
-    __ALWAYS_INLINE void store(T value, _MEM_ORD) __NOEXCEPT { __spirv::OpAtomicStore((_SPIRV_T*)&_value, scope, order, asSPIRV(value)); }
-    __ALWAYS_INLINE void store(T value, _MEM_ORD) volatile __NOEXCEPT { __spirv::OpAtomicStore((_SPIRV_T*)&_value, scope, order, asSPIRV(value)); }
+    __ALWAYS_INLINE void store(T value, _MEM_ORD) __NOEXCEPT { __ops::__store(&_value, value, order, scope); }
+    __ALWAYS_INLINE void store(T value, _MEM_ORD) volatile __NOEXCEPT { __ops::__store(&_value, value, order, scope); }
 
     __atomic_base() __NOEXCEPT = default;
     constexpr __atomic_base(T v) __NOEXCEPT: _value(v) {}
@@ -92,16 +251,11 @@ struct __atomic_base
 
     __ALWAYS_INLINE T operator=(T value) __NOEXCEPT { store(value); return value; }
     __ALWAYS_INLINE T operator=(T value) volatile __NOEXCEPT { store(value); return value; }
-
-protected:
-    __ALWAYS_INLINE T const& asT(_SPIRV_T const& S) const volatile __NOEXCEPT { return reinterpret_cast<T const&>(S); }
-
-    __ALWAYS_INLINE _SPIRV_T const& asSPIRV(T const& t) const volatile __NOEXCEPT { return reinterpret_cast<_SPIRV_T const&>(t); }
 };
 
-#define ATOMIC_ARITHMETIC_OPERATION(symbol, name, spirv_opcode) \
-    __ALWAYS_INLINE auto fetch_##name(result_type value, _MEM_ORD) __NOEXCEPT { return this->asT(spirv_opcode((_SPIRV_T*)&this->_value, scope, order, value)); } \
-    __ALWAYS_INLINE auto fetch_##name(result_type value, _MEM_ORD) volatile __NOEXCEPT { return this->asT(spirv_opcode((_SPIRV_T*)&this->_value, scope, order, value)); } \
+#define ATOMIC_ARITHMETIC_OPERATION(symbol, name) \
+    __ALWAYS_INLINE auto fetch_##name(result_type value, _MEM_ORD) __NOEXCEPT { return __ops::__fetch_##name(&this->_value, value, order, scope); } \
+    __ALWAYS_INLINE auto fetch_##name(result_type value, _MEM_ORD) volatile __NOEXCEPT { return __ops::__fetch_##name(&this->_value, value, order, scope); } \
     __ALWAYS_INLINE auto operator symbol##=(result_type value) __NOEXCEPT { return fetch_##name(value) symbol value; } \
     __ALWAYS_INLINE auto operator symbol##=(result_type value) volatile __NOEXCEPT { return fetch_##name(value) symbol value; }
 
@@ -113,25 +267,22 @@ struct __atomic_arithmetic_capable : public __atomic_base<T, _SPIRV_T>
 private:
     static_assert(__details::__is_atomic_integer_type<T>::value, "Arithmetic operations are supported only for integer-type atomics.");
     typedef typename __details::__atomic_types<T>::arithmetic_result_type result_type;
+    typedef __atomic_ops<T, _SPIRV_T> __ops;
 
 public:
     using __atomic_base<T, _SPIRV_T>::__atomic_base;
     using __atomic_base<T, _SPIRV_T>::operator=;
 
-    ATOMIC_ARITHMETIC_OPERATION(+, add, __spirv::OpAtomicIAdd);
-    ATOMIC_ARITHMETIC_OPERATION(-, sub, __spirv::OpAtomicISub);
-    ATOMIC_ARITHMETIC_OPERATION(&, and, __spirv::OpAtomicAnd);
-    ATOMIC_ARITHMETIC_OPERATION(| , or, __spirv::OpAtomicOr);
-    ATOMIC_ARITHMETIC_OPERATION(^, xor, __spirv::OpAtomicXor);
-
-    template<class U = T>
-    __ALWAYS_INLINE enable_if_t<is_unsigned<U>::value, U>  fetch_min(result_type value, _MEM_ORD) __NOEXCEPT { return this->asT(__spirv::OpAtomicUMin((_SPIRV_T*)&this->_value, scope, order, value)); } \
-    template<class U = T>
-    __ALWAYS_INLINE enable_if_t<!is_unsigned<U>::value, U> fetch_min(result_type value, _MEM_ORD) volatile __NOEXCEPT { return this->asT(__spirv::OpAtomicSMin((_SPIRV_T*)&this->_value, scope, order, value)); } \
-    template<class U = T>
-    __ALWAYS_INLINE enable_if_t<is_unsigned<U>::value, U> fetch_max(result_type value, _MEM_ORD) __NOEXCEPT { return this->asT(__spirv::OpAtomicUMax((_SPIRV_T*)&this->_value, scope, order, value)); } \
-    template<class U = T>
-    __ALWAYS_INLINE enable_if_t<!is_unsigned<U>::value, U> fetch_max(result_type value, _MEM_ORD) volatile __NOEXCEPT { return this->asT(__spirv::OpAtomicSMax((_SPIRV_T*)&this->_value, scope, order, value)); } \
+    ATOMIC_ARITHMETIC_OPERATION(+, add);
+    ATOMIC_ARITHMETIC_OPERATION(-, sub);
+    ATOMIC_ARITHMETIC_OPERATION(&, and);
+    ATOMIC_ARITHMETIC_OPERATION(| , or);
+    ATOMIC_ARITHMETIC_OPERATION(^, xor);
+
+    __ALWAYS_INLINE T fetch_min(result_type value, _MEM_ORD) __NOEXCEPT { return __ops::__fetch_min(&this->_value, value, order, scope); }
+    __ALWAYS_INLINE T fetch_min(result_type value, _MEM_ORD) volatile __NOEXCEPT { return __ops::__fetch_min(&this->_value, value, order, scope); }
+    __ALWAYS_INLINE T fetch_max(result_type value, _MEM_ORD) __NOEXCEPT { return __ops::__fetch_max(&this->_value, value, order, scope); }
+    __ALWAYS_INLINE T fetch_max(result_type value, _MEM_ORD) volatile __NOEXCEPT { return __ops::__fetch_max(&this->_value, value, order, scope); }
 
     /// \brief operator++ overloads
     ///
@@ -154,6 +305,43 @@ public:
     __ALWAYS_INLINE T operator--( ) volatile __NOEXCEPT { return fetch_sub(1) - 1; }
 };
 
+#define ATOMIC_FLOATING_OPERATION(name) \
+    __ALWAYS_INLINE T fetch_##name(T value, _MEM_ORD) __NOEXCEPT { return __ops::__fetch_f##name(&this->_value, value, order, scope); } \
+    __ALWAYS_INLINE T fetch_##name(T value, _MEM_ORD) volatile __NOEXCEPT { return __ops::__fetch_f##name(&this->_value, value, order, scope); }
+
+/// \brief Class containing atomic floating point arithmetic operations
+///
+/// Operations are lowered to OpAtomicFAddEXT, OpAtomicFMinEXT and OpAtomicFMaxEXT if cl_ext_float_atomics is defined,
+/// otherwise they are emulated with a loop of weak compare exchanges. The loop reads the current value with relaxed order and
+/// retries on failure with relaxed order as well, the successful exchange, which is always made, uses requested memory order.
+template <typename T, typename _SPIRV_T = T>
+struct __atomic_floating_capable : public __atomic_base<T, _SPIRV_T>
+{
+private:
+    static_assert(__details::__is_atomic_floating_type<T>::value, "Floating point arithmetic operations are supported only for floating point type atomics.");
+    typedef __atomic_ops<T, _SPIRV_T> __ops;
+
+public:
+    using __atomic_base<T, _SPIRV_T>::__atomic_base;
+    using __atomic_base<T, _SPIRV_T>::operator=;
+
+    ATOMIC_FLOATING_OPERATION(add)
+    ATOMIC_FLOATING_OPERATION(sub)
+    ATOMIC_FLOATING_OPERATION(min)
+    ATOMIC_FLOATING_OPERATION(max)
+
+    /// \brief operator+= overloads
+    ///
+    __ALWAYS_INLINE T operator+=(T value) __NOEXCEPT { return fetch_add(value) + value; }
+    __ALWAYS_INLINE T operator+=(T value) volatile __NOEXCEPT { return fetch_add(value) + value; }
+
+    /// \brief operator-= overloads
+    ///
+    __ALWAYS_INLINE T operator-=(T value) __NOEXCEPT { return fetch_sub(value) - value; }
+    __ALWAYS_INLINE T operator-=(T value) volatile __NOEXCEPT { return fetch_sub(value) - value; }
+};
+
+#undef ATOMIC_FLOATING_OPERATION
 #undef ATOMIC_ARITHMETIC_OPERATION
 
 }
@@ -39,6 +39,9 @@ struct __is_valid_atomic_type : integral_constant<bool, __is_one_of<T, int, uint
 #if defined(cl_khr_fp64)
     double,
 #endif
+#endif
+#if defined(cl_khr_fp16)
+    half,
 #endif
     float, intptr_t, uintptr_t, size_t, ptrdiff_t>::value> { };
 
@@ -65,6 +68,11 @@ struct __is_atomic_integer_type : integral_constant<bool, is_integral<T>::value
 template <typename T>
 struct __is_atomic_integer_type<T*> : true_type { };
 
+/// \brief Trait checking if type is valid atomic floating-point type
+///
+template <typename T>
+struct __is_atomic_floating_type : integral_constant<bool, is_floating_point<T>::value && __is_valid_atomic_type<T>::value> { };
+
 /// \brief Trait generating pair of types used for matching between OCL C++ and SPIRV types
 ///
 template <typename T>
@@ -77,7 +85,7 @@ struct __atomic_types
 /// \brief Trait generating pair of types used for matching between OCL C++ and SPIRV types
 ///
 /// SPIRV doesn't accept floating point arguments for operations like OpAtomicExchange so we are going to treat float/double as integral types with appropriate size.
-/// Since no arithmetic operations are allowed on floating point atomics there is no 'arithmetic_result_type' defined for them
+/// Floating point arithmetic operations are provided by __atomic_floating_capable which doesn't use 'arithmetic_result_type'
 template <>
 struct __atomic_types<float>
 {
@@ -88,7 +96,7 @@ struct __atomic_types<float>
 /// \brief Trait generating pair of types used for matching between OCL C++ and SPIRV types
 ///
 /// SPIRV doesn't accept floating point arguments for operations like OpAtomicExchange so we are going to treat float/double as integral types with appropriate size.
-/// Since no arithmetic operations are allowed on floating point atomics there is no 'arithmetic_result_type' defined for them
+/// Floating point arithmetic operations are provided by __atomic_floating_capable which doesn't use 'arithmetic_result_type'
 template <>
 struct __atomic_types<double>
 {
@@ -96,6 +104,17 @@ struct __atomic_types<double>
 };
 #endif
 
+#if defined(cl_khr_fp16)
+/// \brief Trait generating pair of types used for matching between OCL C++ and SPIRV types
+///
+/// OpenCL has no 16-bit atomics, operations on half are emulated on the containing 32-bit word by __atomic_ops<half, half>
+template <>
+struct __atomic_types<half>
+{
+    typedef half spirv_type;
+};
+#endif
+
 /// \brief Trait generating pair of types used for matching between OCL C++ and SPIRV types
 ///
 template <typename T>
@@ -0,0 +1,62 @@
+//
+// Copyright (c) 2015-2016 The Khronos Group Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and/or associated documentation files (the
+// "Materials"), to deal in the Materials without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Materials, and to
+// permit persons to whom the Materials are furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Materials.
+//
+// THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+//
+
+#pragma once
+
+#include <__ocl_config.h>
+
+#ifndef OPENCL_LOCK_MAX_BACKOFF
+/// \brief Maximal number of iterations a work-item waits between two attempts of a contended operation
+///
+#define OPENCL_LOCK_MAX_BACKOFF 1024
+#endif
+
+namespace cl
+{
+
+namespace __details
+{
+
+/// \brief Busy waits given number of iterations without touching memory visible to other work-items
+///
+__ALWAYS_INLINE void __lock_pause(uint iterations) __NOEXCEPT
+{
+    for (volatile uint i = 0; i < iterations; ++i) { }
+}
+
+/// \brief Exponential backoff used between attempts of a contended operation, e.g. acquiring a lock or polling a pipe
+///
+struct __lock_backoff
+{
+    __ALWAYS_INLINE void operator()() __NOEXCEPT
+    {
+        __lock_pause(__delay);
+        __delay = __delay < OPENCL_LOCK_MAX_BACKOFF ? __delay * 2 : OPENCL_LOCK_MAX_BACKOFF;
+    }
+
+    uint __delay = 1;
+};
+
+} //end namespace __details
+
+} //end namespace cl
@@ -28,6 +28,7 @@
 #include <__ocl_spirv_pipe_opcodes.h>
 #include <__ocl_type_traits_type_properties.h>
 #include <__ocl_type_traits_type_generators.h>
+#include <__ocl_backoff.h>
 
 namespace cl
 {
@@ -175,9 +176,21 @@ public:
 
         /// \brief Performs read packet from the reserved area of the pipe referred to by index into ref.
         ///
+        /// Returns true on success and false on failure, the raw status of the read is 0 on success and negative otherwise.
         __ALWAYS_INLINE bool read(uint index, T& ref) const __NOEXCEPT
         {
-            return __spirv::__make_OpReservedReadPipe_call<int>(_pipe, _reserve_id, index, (void *)&ref, static_cast<unsigned int>(sizeof(T)), static_cast<unsigned int>(alignof(T)));
+            return __spirv::__make_OpReservedReadPipe_call<int>(_pipe, _reserve_id, index, (void *)&ref, static_cast<unsigned int>(sizeof(T)), static_cast<unsigned int>(alignof(T))) == 0;
+        }
+
+        /// \brief Performs read of count packets starting at index first from the reserved area of the pipe into dst.
+        ///
+        /// Returns true only if all of the packets were read successfully.
+        __ALWAYS_INLINE bool read_range(uint first, uint count, T* dst) const __NOEXCEPT
+        {
+            bool ret = true;
+            for (uint i = 0; i < count; ++i)
+                ret &= read(first + i, dst[i]);
+            return ret;
         }
 
         /// \brief Commits read associated with reservation
@@ -236,7 +249,46 @@ public:
     ///
     __ALWAYS_INLINE bool read(T & ret) const __NOEXCEPT
     {
-        return __spirv::__make_OpReadPipe_call<int>(_handle, (void *)&ret, static_cast<unsigned int>(sizeof(T)), static_cast<unsigned int>(alignof(T)));
+        return __spirv::__make_OpReadPipe_call<int>(_handle, (void *)&ret, static_cast<unsigned int>(sizeof(T)), static_cast<unsigned int>(alignof(T))) == 0;
+    }
+
+    /// \brief Performs read of n packets from a pipe into dst using a single reservation, returns true on success and false on failure
+    ///
+    /// Nothing is read if the reservation of n packets fails.
+    __ALWAYS_INLINE bool read_n(T* dst, uint n) const __NOEXCEPT
+    {
+        auto r = reserve(n);
+        if (!r.is_valid())
+            return false;
+        bool ret = r.read_range(0, n, dst);
+        r.commit();
+        return ret;
+    }
+
+    /// \brief Performs read on a pipe, retrying with exponential backoff at most max_spins times, returns true on success and false on failure
+    ///
+    __ALWAYS_INLINE bool try_read_for(T& ret, uint max_spins) const __NOEXCEPT
+    {
+        __details::__lock_backoff backoff;
+        for (uint spin = 0; spin < max_spins; ++spin)
+        {
+            if (read(ret))
+                return true;
+            backoff();
+        }
+        return read(ret);
+    }
+
+    /// \brief Waits with exponential backoff until at least n packets are stored in a pipe
+    ///
+    /// n is clamped to max_packets(). Please note that the packets may already be consumed by other work-items at the point of return.
+    __ALWAYS_INLINE void wait_until_available(uint n) const __NOEXCEPT
+    {
+        const uint max = max_packets();
+        const uint wanted = n < max ? n : max;
+        __details::__lock_backoff backoff;
+        while (num_packets() < wanted)
+            backoff();
     }
 
     /// \brief Reserves read on a pipe, returns valid reservation object if operation succeeded
@@ -347,9 +399,21 @@ public:
 
         /// \brief Performs write packet specified by ref to the reserved area of the pipe referred to by index.
         ///
+        /// Returns true on success and false on failure, the raw status of the write is 0 on success and negative otherwise.
         __ALWAYS_INLINE bool write(uint index, const T& ref) __NOEXCEPT
         {
-            return __spirv::__make_OpReservedWritePipe_call<int>(_pipe, _reserve_id, index, (void *)&ref, static_cast<unsigned int>(sizeof(T)), static_cast<unsigned int>(alignof(T)));
+            return __spirv::__make_OpReservedWritePipe_call<int>(_pipe, _reserve_id, index, (void *)&ref, static_cast<unsigned int>(sizeof(T)), static_cast<unsigned int>(alignof(T))) == 0;
+        }
+
+        /// \brief Performs write of count packets from src to the reserved area of the pipe starting at index first.
+        ///
+        /// Returns true only if all of the packets were written successfully.
+        __ALWAYS_INLINE bool write_range(uint first, uint count, const T* src) __NOEXCEPT
+        {
+            bool ret = true;
+            for (uint i = 0; i < count; ++i)
+                ret &= write(first + i, src[i]);
+            return ret;
         }
 
         /// \brief Commits write associated with reservation object
@@ -408,7 +472,20 @@ public:
     ///
     __ALWAYS_INLINE bool write(const T & ret) const __NOEXCEPT
     {
-        return __spirv::__make_OpWritePipe_call<int>(_handle, (void *)&ret, static_cast<unsigned int>(sizeof(T)), static_cast<unsigned int>(alignof(T)));
+        return __spirv::__make_OpWritePipe_call<int>(_handle, (void *)&ret, static_cast<unsigned int>(sizeof(T)), static_cast<unsigned int>(alignof(T))) == 0;
+    }
+
+    /// \brief Performs write of n packets from src to a pipe using a single reservation, returns true on success and false on failure
+    ///
+    /// Nothing is written if the reservation of n packets fails.
+    __ALWAYS_INLINE bool write_n(const T* src, uint n) __NOEXCEPT
+    {
+        auto r = reserve(n);
+        if (!r.is_valid())
+            return false;
+        bool ret = r.write_range(0, n, src);
+        r.commit();
+        return ret;
     }
 
     /// \brief Reserves write on a pipe, returns valid reservation object if operation succeeded
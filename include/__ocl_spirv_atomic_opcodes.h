@@ -77,6 +77,12 @@ extern auto OpAtomicOr(unsigned int* Pointer, memory_scope Scope, memory_order S
 extern auto OpAtomicXor(int* Pointer, memory_scope Scope, memory_order Semantics, int Value) -> int;
 extern auto OpAtomicXor(unsigned int* Pointer, memory_scope Scope, memory_order Semantics, unsigned int Value) -> unsigned int;
 
+#if defined(cl_ext_float_atomics)
+extern auto OpAtomicFAddEXT(float* Pointer, memory_scope Scope, memory_order Semantics, float Value) -> float;
+extern auto OpAtomicFMinEXT(float* Pointer, memory_scope Scope, memory_order Semantics, float Value) -> float;
+extern auto OpAtomicFMaxEXT(float* Pointer, memory_scope Scope, memory_order Semantics, float Value) -> float;
+#endif
+
 #if (__INTPTR_WIDTH__ == 32) || (defined(cl_khr_int64_base_atomics) && defined(cl_khr_int64_extended_atomics))
 extern auto OpAtomicLoad(intptr_t* Pointer, memory_scope Scope, memory_order Semantics ) -> intptr_t;
 extern auto OpAtomicLoad(uintptr_t* Pointer, memory_scope Scope, memory_order Semantics ) -> uintptr_t;
@@ -200,6 +206,12 @@ extern auto OpAtomicXor(unsigned long* Pointer, memory_scope Scope, memory_order
 extern auto OpAtomicLoad(double* Pointer, memory_scope Scope, memory_order Semantics ) -> double;
 extern auto OpAtomicStore(double* Pointer, memory_scope Scope, memory_order Semantics, double Value) -> void;
 extern auto OpAtomicExchange(double* Pointer, memory_scope Scope, memory_order Semantics, double Value) -> double;
+
+#if defined(cl_ext_float_atomics)
+extern auto OpAtomicFAddEXT(double* Pointer, memory_scope Scope, memory_order Semantics, double Value) -> double;
+extern auto OpAtomicFMinEXT(double* Pointer, memory_scope Scope, memory_order Semantics, double Value) -> double;
+extern auto OpAtomicFMaxEXT(double* Pointer, memory_scope Scope, memory_order Semantics, double Value) -> double;
+#endif
 #endif
 
 #endif
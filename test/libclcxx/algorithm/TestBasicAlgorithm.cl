@@ -0,0 +1,41 @@
+// RUN: %clang_cc1 %s -triple spir-unknown-unknown -cl-std=c++ -emit-llvm -pedantic -verify
+// expected-no-diagnostics
+
+#include <opencl_algorithm>
+#include <opencl_memory>
+using namespace cl;
+
+struct square
+{
+    float operator()(float x) const { return x * x; }
+};
+
+kernel void worker(global_ptr<float> in, global_ptr<float> out)
+{
+    local<array<float, 256>> tile;
+    auto first = tile.begin();
+    auto last = tile.end();
+
+    fill(work_group{}, first, last, 0.0f);
+    copy(work_group{}, in, in + 256, first);
+
+    // every sub-group and every work-item transforms its own part of the tile
+    const size_t per_sub_group = 256 / get_num_sub_groups();
+    auto sub_group_first = first + get_sub_group_id() * per_sub_group;
+    transform(sub_group{}, sub_group_first, sub_group_first + per_sub_group, sub_group_first, square());
+    work_group_barrier(mem_fence::local);
+
+    const size_t per_item = 256 / (get_local_size(0) * get_local_size(1) * get_local_size(2));
+    auto item_first = first + get_local_linear_id() * per_item;
+    transform(work_item{}, item_first, item_first + per_item, item_first, item_first, plus<>());
+    work_group_barrier(mem_fence::local);
+
+    for_each(work_group{}, first, last, [](float& x) { x += 1.0f; });
+
+    float sum = reduce(work_group{}, first, last, 0.0f);
+    float biggest = reduce(sub_group{}, first, first + 8, 0.0f, maximum<>());
+    auto it = find(work_group{}, first, last, 1.0f);
+    find_if(work_item{}, first, last, [](float x) { return x > 2.0f; });
+
+    out[0] = sum + biggest + *it;
+}
@@ -0,0 +1,19 @@
+// RUN: %clang_cc1 %s -triple spir-unknown-unknown -cl-std=c++ -emit-llvm -pedantic -verify
+// expected-no-diagnostics
+
+#include <opencl_algorithm>
+#include <opencl_atomic>
+#include <opencl_memory>
+using namespace cl;
+
+struct is_active
+{
+    bool operator()(uint ray) const { return (ray & 1) != 0; }
+};
+
+kernel void worker(global_ptr<uint> rays, global_ptr<uint> survivors, local_ptr<uint> tile, global_ptr<atomic<uint>> counter, uint n)
+{
+    uint count = work_group_copy_if(rays.get(), n, tile.get(), is_active());
+    count += work_group_copy_if(tile.get(), count, survivors.get(), [](uint x) { return x > 16; }, counter.get());
+    work_group_partition(rays.get(), n, tile.get(), is_active());
+}
@@ -0,0 +1,19 @@
+// RUN: %clang_cc1 %s -triple spir-unknown-unknown -cl-std=c++ -emit-llvm -pedantic -verify
+// expected-no-diagnostics
+
+#include <opencl_algorithm>
+#include <opencl_atomic>
+#include <opencl_memory>
+using namespace cl;
+
+struct luminance_bin
+{
+    uint operator()(float x) const { return static_cast<uint>(x * 255.0f); }
+};
+
+kernel void worker(global_ptr<float> pixels, global_ptr<atomic<uint>> histogram, global_ptr<atomic<uint>> parity)
+{
+    const float x = pixels.get()[get_global_id(0)];
+    work_group_histogram<256>(x, luminance_bin(), histogram);
+    work_group_histogram<2, false>(get_global_id(0), [](size_t i) { return static_cast<uint>(i & 1); }, parity);
+}
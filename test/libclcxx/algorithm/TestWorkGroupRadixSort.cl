@@ -0,0 +1,16 @@
+// RUN: %clang_cc1 %s -triple spir-unknown-unknown -cl-std=c++ -emit-llvm -pedantic -verify
+// expected-no-diagnostics
+
+#include <opencl_algorithm>
+#include <opencl_memory>
+using namespace cl;
+
+kernel void worker(local_ptr<uint> keys, local_ptr<int> signed_keys, local_ptr<float> float_keys, local_ptr<ushort> values,
+                   local_ptr<uint> key_scratch, local_ptr<ushort> value_scratch)
+{
+    work_group_radix_sort(keys, values, 512);
+    work_group_radix_sort<8>(keys, values, 512, key_scratch, value_scratch);
+    work_group_radix_sort(signed_keys, 300);
+    work_group_radix_sort<2>(float_keys, 512);
+    work_group_radix_sort<1>(keys, 512, key_scratch);
+}
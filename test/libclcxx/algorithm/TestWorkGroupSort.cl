@@ -0,0 +1,32 @@
+// RUN: %clang_cc1 %s -triple spir-unknown-unknown -cl-std=c++ -emit-llvm -pedantic -verify
+// expected-no-diagnostics
+
+#include <opencl_algorithm>
+#include <opencl_memory>
+using namespace cl;
+
+struct candidate
+{
+    float distance;
+    uint index;
+};
+
+struct closer
+{
+    bool operator()(const candidate& a, const candidate& b) const { return a.distance < b.distance; }
+};
+
+kernel void worker(local_ptr<float> tile, local_ptr<candidate> candidates, uint n)
+{
+    work_group_sort(tile, n);
+    work_group_sort(tile, n, greater<>());
+    work_group_sort<256>(tile);
+    work_group_sort<100>(candidates, closer());
+
+    float x = tile.get()[get_local_linear_id()];
+    sub_group_sort(x);
+    sub_group_sort(x, greater<float>());
+
+    candidate c = { x, n };
+    sub_group_sort(c, closer());
+}
@@ -0,0 +1,27 @@
+// RUN: %clang_cc1 %s -triple spir-unknown-unknown -cl-std=c++ -emit-llvm -pedantic -verify
+// expected-no-diagnostics
+
+#include <opencl_async_copy>
+#include <opencl_memory>
+#include <opencl_synchronization>
+#include <opencl_work_item>
+using namespace cl;
+
+kernel void worker(global_ptr<const float4> input, global_ptr<float> columns, global_ptr<float4> output, local_ptr<float4> tile, local_ptr<float> column, uint width)
+{
+    const size_t offset = get_group_id(0) * get_local_size(0);
+    global_ptr<const float4> block(input.get() + offset);
+    global_ptr<float> strided(columns.get() + get_group_id(0));
+    prefetch(global_ptr<const float4>(block.get() + get_local_size(0)), get_local_size(0));
+
+    async_copy_event e = async_work_group_copy(tile, block, get_local_size(0));
+    e = async_work_group_strided_copy(column, strided, get_local_size(0), width, e);
+    wait_group_events(e);
+
+    tile.get()[get_local_id(0)] *= column.get()[get_local_id(0)];
+    work_group_barrier(mem_fence::local);
+
+    async_copy_event events[] = { async_work_group_copy(global_ptr<float4>(output.get() + offset), tile, get_local_size(0)),
+                                  async_work_group_strided_copy(strided, column, get_local_size(0), width) };
+    wait_group_events(events);
+}
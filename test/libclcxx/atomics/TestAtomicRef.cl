@@ -0,0 +1,22 @@
+// RUN: %clang_cc1 %s -triple spir-unknown-unknown -cl-std=c++ -emit-llvm -pedantic -nobuiltininc -verify -O1 -o -
+// expected-no-diagnostics
+
+#include <opencl_work_item>
+#include <opencl_atomic>
+
+__kernel void scatter(__global float* grid, __global uint* cells, __global uint* counts, __local uint* tally)
+{
+    size_t i = cl::get_global_id(0);
+    cl::atomic_ref<float, cl::memory_order_relaxed> cell(grid[cells[i]]);
+    cell.fetch_add(1.0f);
+    cell -= 0.5f;
+
+    cl::atomic_ref<uint, cl::memory_order_relaxed, cl::memory_scope_work_group> local_count(tally[0]);
+    ++local_count;
+    local_count.fetch_max(static_cast<uint>(i));
+
+    auto count = cl::make_atomic_ref<cl::memory_order_relaxed>(counts[cells[i]]);
+    uint expected = count.load();
+    count.compare_exchange_weak(expected, expected + 1);
+    count.fetch_or(1u, cl::memory_order_acq_rel);
+}
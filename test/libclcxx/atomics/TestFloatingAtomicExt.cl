@@ -0,0 +1,17 @@
+// RUN: %clang_cc1 %s -triple spir-unknown-unknown -cl-std=c++ -emit-llvm -pedantic -nobuiltininc -verify -O1 -o -
+// expected-no-diagnostics
+#define cl_ext_float_atomics 1
+
+#include <opencl_work_item>
+#include <opencl_atomic>
+
+__kernel void density(__global float* mass, __global uint* cell, __global volatile cl::atomic_float* rho, __global cl::atomic_float* bounds)
+{
+    size_t i = cl::get_global_id(0);
+    float m = mass[i];
+    rho[cell[i]].fetch_add(m, cl::memory_order_relaxed);
+    rho[cell[i]] -= 0.5f * m;
+    cl::atomic_fetch_sub_explicit(&rho[cell[i]], 0.5f * m, cl::memory_order_relaxed, cl::memory_scope_device);
+    bounds[0].fetch_min(m, cl::memory_order_relaxed);
+    cl::atomic_fetch_max(&bounds[1], m);
+}
@@ -0,0 +1,25 @@
+// RUN: %clang_cc1 %s -triple spir-unknown-unknown -cl-std=c++ -emit-llvm -pedantic -nobuiltininc -verify -O1 -o -
+// expected-no-diagnostics
+
+#ifdef cl_khr_fp16
+#pragma OPENCL EXTENSION cl_khr_fp16 : enable
+#endif
+
+#include <opencl_work_item>
+#include <opencl_atomic>
+
+#ifdef cl_khr_fp16
+__kernel void accumulate(__global half* weights, __global cl::atomic_half* sums)
+{
+    size_t i = cl::get_global_id(0);
+    half w = weights[i];
+    sums[0].fetch_add(w, cl::memory_order_relaxed);
+    sums[1].fetch_max(w);
+    half expected = sums[2].load();
+    sums[2].compare_exchange_strong(expected, w);
+    sums[3].store(sums[3].exchange(w));
+
+    cl::atomic_ref<half, cl::memory_order_relaxed> weight(weights[i]);
+    weight -= w;
+}
+#endif
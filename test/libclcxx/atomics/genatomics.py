@@ -16,16 +16,23 @@ class Type(IntEnum):
     ptrdiff_t = 7
     intptr_t = 8
     uintptr_t = 9
+    half = 10
     
     # invalid atomic types
-    bool = 10
-    char = 11
-    short = 12
-    memory_order = 13
-    memory_scope = 14
+    bool = 11
+    char = 12
+    short = 13
+    memory_order = 14
+    memory_scope = 15
     
     FIRST_INVALID = bool
   
+class Arithmetic(IntEnum):
+    none = 0 #valid for all atomic types
+    all = 1 #valid for integer, pointer and floating point atomic types
+    integer = 2 #valid for integer and pointer atomic types only
+    minmax = 3 #valid for integer and floating point atomic types, not generated for pointers
+  
 class GenericType(IntEnum):
     A = 0 #atomic type
     C = 1 #underlying type
@@ -73,8 +80,13 @@ class Atomic:
     def get_tmp_name_for_generic(self, generic, name_suffix = ""):
         return "_"+self.get_short_name()+generic.name+name_suffix;
             
-    def is_arithmetic_capable(self):
-        return (self.is_pointer or (self.type != Type.float and self.type != Type.double))
+    def is_floating(self):
+        return (not self.is_pointer and (self.type == Type.half or self.type == Type.float or self.type == Type.double))
+            
+    def is_arithmetic_capable(self, arithmetic):
+        if (arithmetic == Arithmetic.integer):
+            return not self.is_floating()
+        return True
             
     def get_short_name(self):
         return ("p" if self.is_pointer else "")+self.type.name
@@ -100,7 +112,10 @@ class Atomic:
         if (self.ifdef == True):
             return
             
-        if (self.is_pointer == False and (self.type == Type.double or self.type == Type.long or self.type == Type.ulong)):
+        if (self.is_pointer == False and self.type == Type.half):
+            self.ifdef = True
+            out.write("#if defined(cl_khr_fp16)\n")
+        elif (self.is_pointer == False and (self.type == Type.double or self.type == Type.long or self.type == Type.ulong)):
             self.ifdef = True
             if (self.type == Type.double):
                 out.write("#if defined(cl_khr_fp64) && defined(cl_khr_int64_base_atomics) && defined(cl_khr_int64_extended_atomics)\n")
@@ -115,7 +130,7 @@ class Atomic:
     
 declarations = []
 class AtomicFunctionCall:
-    def __init__(self, atomic, fname, fargs, fopt_args, rettype, arithmetic = False):
+    def __init__(self, atomic, fname, fargs, fopt_args, rettype, arithmetic = Arithmetic.none):
         self.atomic = atomic
         self.fname = fname
         self.fargs = fargs
@@ -124,7 +139,10 @@ class AtomicFunctionCall:
         self.is_arithmetic_func = arithmetic
         
     def is_valid(self):
-        return (self.atomic.is_valid() and (self.atomic.is_arithmetic_capable() or not self.is_arithmetic_func))
+        return (self.atomic.is_valid() and self.atomic.is_arithmetic_capable(self.is_arithmetic_func))
+        
+    def is_generated(self):
+        return not (self.atomic.is_pointer and self.is_arithmetic_func == Arithmetic.minmax)
         
     def spawn_call(self, out):
         
@@ -180,33 +198,36 @@ class AtomicFunctionCall:
         
    
 atomic_functions = [
-    ("store", [GenericType.C], [Type.memory_order, Type.memory_scope], None, False),
-    ("load", [], [Type.memory_order, Type.memory_scope], GenericType.C, False),
-    ("exchange", [GenericType.C], [Type.memory_order, Type.memory_scope], GenericType.C, False),
+    ("store", [GenericType.C], [Type.memory_order, Type.memory_scope], None, Arithmetic.none),
+    ("load", [], [Type.memory_order, Type.memory_scope], GenericType.C, Arithmetic.none),
+    ("exchange", [GenericType.C], [Type.memory_order, Type.memory_scope], GenericType.C, Arithmetic.none),
     
-    ("fetch_add", [GenericType.M], [Type.memory_order, Type.memory_scope], GenericType.C, True),
-    ("fetch_sub", [GenericType.M], [Type.memory_order, Type.memory_scope], GenericType.C, True),
-    ("fetch_and", [GenericType.M], [Type.memory_order, Type.memory_scope], GenericType.C, True),
-    ("fetch_or", [GenericType.M], [Type.memory_order, Type.memory_scope], GenericType.C, True),
-    ("fetch_xor", [GenericType.M], [Type.memory_order, Type.memory_scope], GenericType.C, True),
+    ("fetch_add", [GenericType.M], [Type.memory_order, Type.memory_scope], GenericType.C, Arithmetic.all),
+    ("fetch_sub", [GenericType.M], [Type.memory_order, Type.memory_scope], GenericType.C, Arithmetic.all),
+    ("fetch_and", [GenericType.M], [Type.memory_order, Type.memory_scope], GenericType.C, Arithmetic.integer),
+    ("fetch_or", [GenericType.M], [Type.memory_order, Type.memory_scope], GenericType.C, Arithmetic.integer),
+    ("fetch_xor", [GenericType.M], [Type.memory_order, Type.memory_scope], GenericType.C, Arithmetic.integer),
+    ("fetch_min", [GenericType.M], [Type.memory_order, Type.memory_scope], GenericType.C, Arithmetic.minmax),
+    ("fetch_max", [GenericType.M], [Type.memory_order, Type.memory_scope], GenericType.C, Arithmetic.minmax),
     
-    ("compare_exchange_strong", [GenericType.C_ref, GenericType.C], [], Type.bool, False),
-    ("compare_exchange_strong", [GenericType.C_ref, GenericType.C, Type.memory_order, Type.memory_order], [Type.memory_scope], Type.bool, False),
-    ("compare_exchange_weak", [GenericType.C_ref, GenericType.C], [], Type.bool, False),
-    ("compare_exchange_weak", [GenericType.C_ref, GenericType.C, Type.memory_order, Type.memory_order], [Type.memory_scope], Type.bool, False)
+    ("compare_exchange_strong", [GenericType.C_ref, GenericType.C], [], Type.bool, Arithmetic.none),
+    ("compare_exchange_strong", [GenericType.C_ref, GenericType.C, Type.memory_order, Type.memory_order], [Type.memory_scope], Type.bool, Arithmetic.none),
+    ("compare_exchange_weak", [GenericType.C_ref, GenericType.C], [], Type.bool, Arithmetic.none),
+    ("compare_exchange_weak", [GenericType.C_ref, GenericType.C, Type.memory_order, Type.memory_order], [Type.memory_scope], Type.bool, Arithmetic.none)
 ]
 
 files = {}
 
 def make_header(file, neg):
     file.write("// RUN: %clang_cc1 %s -triple spir-unknown-unknown -cl-std=c++ -fsyntax-only -pedantic -verify\n")
-    file.write("// RUN: %clang_cc1 %s -triple spir-unknown-unknown -cl-std=c++ -fsyntax-only -pedantic -verify -emit-llvm -o - -cl-fp64-enable -Dcl_khr_int64_base_atomics -Dcl_khr_int64_extended_atomics\n")
+    file.write("// RUN: %clang_cc1 %s -triple spir-unknown-unknown -cl-std=c++ -fsyntax-only -pedantic -verify -emit-llvm -o - -cl-fp64-enable -Dcl_khr_fp16 -Dcl_khr_int64_base_atomics -Dcl_khr_int64_extended_atomics\n")
     if (neg == False):
         file.write("// expected-no-diagnostics\n\n")
     else:
         file.write("// XFAIL: *\n\n")
 
     file.write("#include <opencl_atomic>\nusing namespace cl;\n\n")
+    file.write("#if defined(cl_khr_fp16)\n#pragma OPENCL EXTENSION cl_khr_fp16 : enable\n#endif\n\n")
     file.write("kernel void worker()\n{\n")
     
 def make_footer(file):
@@ -252,6 +273,8 @@ def generate_atomic_test_cases():
         
         for name, args, opt_args, rettype, arithm in atomic_functions:
             call = AtomicFunctionCall(atom, name, args, opt_args, rettype, arithm)
+            if (not call.is_generated()):
+                continue
             out = None
             if (call.is_valid()):
                 out = open_file(atom, name)
@@ -0,0 +1,24 @@
+// RUN: %clang_cc1 %s -triple spir-unknown-unknown -cl-std=c++ -emit-llvm -pedantic -verify
+// expected-no-diagnostics
+
+#include <opencl_concurrent_queue>
+#include <opencl_memory>
+#include <opencl_work_item>
+using namespace cl;
+
+typedef concurrent_queue<uint, 4096> work_queue;
+
+kernel void worker(global_ptr<work_queue> queue, global_ptr<uint> results)
+{
+    uint item = 0;
+    if (queue->try_pop(item))
+        results.get()[item] = item;
+
+    const bool split = (item & 1) != 0;
+    queue->push_n(item * 2, split, memory_order_release);
+    queue->try_push(item + 1, memory_order_acq_rel, memory_scope_device);
+
+    uint next = 0;
+    if (queue->pop_n(next, true, memory_order_acquire))
+        results.get()[next] = queue->size();
+}
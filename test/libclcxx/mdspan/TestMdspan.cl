@@ -0,0 +1,36 @@
+// RUN: %clang_cc1 %s -triple spir-unknown-unknown -cl-std=c++ -emit-llvm -pedantic -verify
+// expected-no-diagnostics
+
+#include <opencl_mdspan>
+#include <opencl_memory>
+#include <opencl_work_item>
+using namespace cl;
+
+static_assert(extents<4, dynamic_extent, 8>::rank() == 3, "rank should count all extents");
+static_assert(extents<4, dynamic_extent, 8>::rank_dynamic() == 1, "rank_dynamic should count dynamic extents");
+static_assert(extents<4, 8>().size() == 32, "static extents should fold to constants");
+static_assert(layout_right::mapping<extents<4, 8>>(extents<4, 8>()).stride(0) == 8, "row-major stride");
+static_assert(layout_left::mapping<extents<4, 8>>(extents<4, 8>()).stride(1) == 4, "column-major stride");
+static_assert(dextents<2>::rank_dynamic() == 2, "dextents should have only dynamic extents");
+
+kernel void worker(global_ptr<float> image, global_ptr<const float> weights, local_ptr<float> scratch, uint width, uint height, uint pitch)
+{
+    mdspan<float, dextents<2>, layout_stride> pixels(image, layout_stride::mapping<dextents<2>>(dextents<2>(height, width), { pitch, 1 }));
+    global_mdspan<const float, extents<3, 3>> kernel3x3(weights);
+    local_mdspan<float, extents<16, 16>, layout_tiled<4, 4>> tile(scratch);
+    local_mdspan<float, extents<16, 16>, layout_morton> zorder(scratch);
+
+    const size_t x = get_global_id(0);
+    const size_t y = get_global_id(1);
+    float sum = 0.0f;
+    for (size_t i = 0; i < kernel3x3.extent(0); ++i)
+        for (size_t j = 0; j < kernel3x3.extent(1); ++j)
+            sum += kernel3x3(i, j);
+
+    tile(y % 16, x % 16) = sum;
+    zorder(x % 16, y % 16) += 1.0f;
+    pixels(y, x) = sum;
+
+    mdspan<float, extents<dynamic_extent, 4>, layout_left> columns(image, height);
+    columns(y, x % 4) *= 2.0f;
+}
@@ -0,0 +1,27 @@
+// RUN: %clang_cc1 %s -triple spir-unknown-unknown -cl-std=c++ -emit-llvm -pedantic -verify
+// expected-no-diagnostics
+
+#include <opencl_memory>
+#include <opencl_mutex>
+#include <opencl_work_item>
+using namespace cl;
+
+kernel void worker(global_ptr<spin_lock<>> bucket_locks, global_ptr<ticket_lock<>> free_list_lock, global_ptr<uint> buckets, local_ptr<spin_lock<memory_scope_work_group>> tile_lock)
+{
+    const uint key = static_cast<uint>(get_global_id(0)) % 64;
+    global_ptr<uint> data = buckets;
+
+    bucket_locks.get()[key].execute([&]() { data.get()[key] += 1; });
+    free_list_lock->execute([&]() { data.get()[64] += 1; });
+
+    {
+        sub_group_lock_guard<ticket_lock<>> guard(*free_list_lock);
+        data.get()[128 + get_sub_group_local_id()] += 1;
+    }
+
+    if (get_local_linear_id() == 0)
+    {
+        lock_guard<spin_lock<memory_scope_work_group>> guard(*tile_lock);
+        data.get()[66] += 1;
+    }
+}
@@ -0,0 +1,34 @@
+// RUN: %clang_cc1 %s -triple spir-unknown-unknown -cl-std=c++ -fsyntax-only -pedantic -verify -O0 -emit-llvm -o /dev/null
+// expected-no-diagnostics
+
+#include <opencl_pipe>
+
+kernel void worker1(const cl::pipe<int4, cl::pipe_access::read> in)
+{
+    int4 vals[8];
+
+    bool ok = in.read_n(vals, 8);
+
+    auto r1 = in.reserve(8);
+    if(r1) { ok = r1.read_range(0, 4, vals) && r1.read_range(4, 4, vals + 4); }
+    r1.commit();
+
+    auto r2 = in.work_group_reserve(8);
+    if(r2) { ok = r2.read_range(0, 8, vals); }
+    r2.commit();
+}
+
+kernel void worker2(cl::pipe<int4, cl::pipe_access::write> out)
+{
+    int4 vals[8] = { 0 };
+
+    bool ok = out.write_n(vals, 8);
+
+    auto r3 = out.reserve(8);
+    if(r3) { ok = r3.write_range(0, 4, vals) && r3.write_range(4, 4, vals + 4); }
+    r3.commit();
+
+    auto r4 = out.sub_group_reserve(8);
+    if(r4) { ok = r4.write_range(0, 8, vals); }
+    r4.commit();
+}
@@ -0,0 +1,21 @@
+// RUN: %clang_cc1 %s -triple spir-unknown-unknown -cl-std=c++ -fsyntax-only -pedantic -verify -O0 -emit-llvm -o /dev/null
+// expected-no-diagnostics
+
+#include <opencl_memory>
+#include <opencl_pipe>
+#include <opencl_work_group>
+
+kernel void worker1(const cl::pipe<int4, cl::pipe_access::read> in, cl::local_ptr<int4[]> tile, cl::local_ptr<int4[]> lanes)
+{
+    bool ok = cl::work_group_pipe_read(in, tile, 256);
+    cl::work_group_barrier(cl::mem_fence::local);
+
+    // lanes holds 16 packets per sub-group
+    ok &= cl::sub_group_pipe_read(in, lanes, 16);
+}
+
+kernel void worker2(cl::pipe<int4, cl::pipe_access::write> out, cl::local_ptr<int4[]> tile, cl::local_ptr<int4[]> lanes)
+{
+    bool ok = cl::work_group_pipe_write(out, tile, 256);
+    ok &= cl::sub_group_pipe_write(out, lanes, 16);
+}
@@ -0,0 +1,27 @@
+// RUN: %clang_cc1 %s -triple spir-unknown-unknown -cl-std=c++ -fsyntax-only -pedantic -verify -O0 -emit-llvm -o /dev/null
+// expected-no-diagnostics
+
+#include <opencl_pipe>
+
+kernel void worker1(const cl::pipe<int4, cl::pipe_access::read> in)
+{
+    int4 val;
+    bool ok = in.try_read_for(val, 64);
+
+    in.wait_until_available(16);
+    ok &= in.read(val);
+}
+
+kernel void worker2(const cl::pipe<int4, cl::pipe_access::write> out)
+{
+    const int4 val = { 0 };
+
+    cl::pipe_flow_controller<int4> flow(out);
+    if (!flow.throttled())
+        flow.try_write(val);
+    flow.write(val);
+
+    cl::pipe_flow_controller<int4> strict(out, 8);
+    uint mark = strict.high_water_mark();
+    strict.write(val);
+}
@@ -0,0 +1,40 @@
+// RUN: %clang_cc1 %s -triple spir-unknown-unknown -cl-std=c++ -fsyntax-only -pedantic -verify -O0 -emit-llvm -o /dev/null
+// expected-no-diagnostics
+
+#include <opencl_pipe>
+
+cl::pipe_storage<cl::stream_packet<int, 4>, 128> samples;
+
+kernel void worker1(const cl::pipe<cl::stream_packet<float, 16>, cl::pipe_access::read> in, cl::global_ptr<float> out)
+{
+    cl::stream_channel<float, 16> channel(in);
+
+    float value;
+    float sum = 0.0f;
+    while (channel.read(value))
+        sum += value;
+
+    float16 chunk;
+    uint count;
+    if (channel.read(chunk, count))
+        sum += chunk.s0 * count;
+
+    out.get()[0] = sum + channel.buffered();
+}
+
+kernel void worker2(const cl::pipe<cl::stream_packet<float, 16>, cl::pipe_access::write> out, uint n)
+{
+    cl::stream_channel<float, 16, cl::pipe_access::write> channel(out);
+
+    for (uint i = 0; i < n; ++i)
+        channel.write(static_cast<float>(i));
+    const float16 ones = { 1.0f };
+    channel.write(ones, 5);
+    bool ok = channel.flush();
+    uint left = channel.buffered();
+
+    auto ints = cl::make_stream_channel<cl::pipe_access::write>(samples);
+    const int4 quad = { 1, 2, 3, 4 };
+    ints.write(quad);
+    ints.flush();
+}
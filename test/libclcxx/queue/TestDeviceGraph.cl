@@ -0,0 +1,25 @@
+// RUN: %clang_cc1 %s -triple spir-unknown-unknown -emit-llvm -O0 -cl-std=c++ -fsyntax-only -pedantic -verify
+// expected-no-diagnostics
+
+#include <opencl_device_queue>
+
+kernel void worker( cl::device_queue q )
+{
+    auto graph = cl::make_device_graph(
+        cl::make_graph_node( cl::ndrange( 64 ), [](int level){}, 0 ),
+        cl::make_graph_node( cl::ndrange( 32 ), [](int level){}, 1 ),
+        cl::make_graph_node( cl::ndrange( 16, 16 ), [](float scale){}, 0.5f ),
+        cl::make_graph_node( cl::ndrange( 64 ), [](cl::local_ptr<int> a){}, cl::local_ptr<int>::size_type{16} ) );
+
+    graph.add_edge( 0, 1 );
+    graph.add_edge( 1, 2 );
+    graph.add_edge( 0, 2 );
+    graph.add_edge( 2, 3 );
+    bool chained = graph.has_edge( 1, 2 );
+
+    cl::enqueue_status status = graph.enqueue( q );
+
+    cl::event done;
+    status = graph.enqueue( q, &done, cl::enqueue_policy::wait_kernel );
+    done.release();
+}
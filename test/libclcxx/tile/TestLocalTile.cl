@@ -0,0 +1,37 @@
+// RUN: %clang_cc1 %s -triple spir-unknown-unknown -cl-std=c++ -emit-llvm -pedantic -verify
+// expected-no-diagnostics
+
+#include <opencl_memory>
+#include <opencl_tile>
+#include <opencl_work_item>
+using namespace cl;
+
+static_assert(local_tile<float, 32, 32>::padding == 1, "rows spanning all banks should be padded by one element");
+static_assert(local_tile<uchar, 16, 128>::padding == 4, "rows of bytes should be padded by one bank word");
+static_assert(local_tile<float, 16, 17>::padding == 0, "rows not spanning all banks should not be padded");
+static_assert(local_tile<float, 32, 48>::padding == 1, "rows sharing a power of two with the banks should be padded");
+static_assert(local_tile<ushort, 16, 64>::padding == 2, "rows of halfwords should be padded by one bank word");
+static_assert(local_tile<long, 32, 32>::padding == 1, "rows of 8-byte elements should have an odd pitch");
+static_assert(local_tile<ulong, 16, 17>::padding == 0, "rows of 8-byte elements with an odd pitch should not be padded");
+static_assert(local_tile<ulong, 8, 48>::padding == 1, "rows of 8-byte elements sharing a power of two with the banks should be padded");
+static_assert(local_tile<float, 32, 32, 0>::pitch == 32, "explicit padding should be used");
+
+kernel void worker(global_ptr<const float> a, global_ptr<float> at, uint width)
+{
+    local<local_tile<float, 32, 32>> tile;
+    local<local_tile<float, 32, 32>> transposed;
+
+    global_ptr<const float> block(a.get() + get_group_id(1) * 32 * width + get_group_id(0) * 32);
+    work_group_load(tile, block, width);
+    work_group_transpose(tile, transposed);
+
+    float column_sum = 0.0f;
+    auto column = tile.column(get_local_id(0) % 32);
+    for (size_t r = 0; r < column.size(); ++r)
+        column_sum += column[r];
+    transposed.row(0)[get_local_id(0) % 32] += column_sum;
+    transposed(1, 1) = tile(1, 1);
+    work_group_barrier(mem_fence::local);
+
+    work_group_store(transposed, global_ptr<float>(at.get() + get_group_id(0) * 32 * width + get_group_id(1) * 32), width);
+}
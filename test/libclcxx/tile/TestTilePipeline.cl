@@ -0,0 +1,26 @@
+// RUN: %clang_cc1 %s -triple spir-unknown-unknown -cl-std=c++ -emit-llvm -pedantic -verify
+// expected-no-diagnostics
+
+#include <opencl_memory>
+#include <opencl_tile>
+#include <opencl_work_group>
+#include <opencl_work_item>
+using namespace cl;
+
+kernel void worker(global_ptr<float> signal, global_ptr<float> energy, global_ptr<const int> counts, uint n)
+{
+    float sum = 0.0f;
+    tile_pipeline<float, 256> pipeline;
+    pipeline.run(signal, n, [&](local_ptr<float[]> tile, size_t count, size_t index) {
+        for (size_t i = get_local_id(0); i < count; i += get_local_size(0))
+            sum += tile[i] * tile[i];
+    });
+    energy.get()[get_global_id(0)] = sum;
+
+    int total = 0;
+    tile_pipeline<int, 128, 3>().run(counts, n, [&](local_ptr<int[]> tile, size_t count, size_t) {
+        if (get_local_id(0) < count)
+            total += tile[get_local_id(0)];
+    });
+    energy.get()[get_global_id(0)] += static_cast<float>(work_group_reduce<work_group_op::add>(total));
+}
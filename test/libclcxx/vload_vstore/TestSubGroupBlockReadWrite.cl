@@ -0,0 +1,21 @@
+// RUN: %clang_cc1 %s -triple spir-unknown-unknown -cl-std=c++ -emit-llvm -pedantic -verify
+// expected-no-diagnostics
+
+#define cl_intel_subgroups 1
+#include <opencl_vector_load_store>
+#include <opencl_memory>
+using namespace cl;
+
+kernel void worker(global_ptr<float> in, global_ptr<uint> out, global_ptr<short> shorts)
+{
+    float f = sub_group_block_read(in);
+    float4 f4 = sub_group_block_read<4>(in);
+    uint8 u8 = sub_group_block_read<8>(out);
+
+    sub_group_block_write(f, in);
+    sub_group_block_write(f4, in + 128);
+    sub_group_block_write(u8, out);
+
+    short2 s2 = sub_group_block_read<2>(shorts);
+    sub_group_block_write(s2, shorts);
+}
@@ -0,0 +1,20 @@
+// RUN: %clang_cc1 %s -triple spir-unknown-unknown -cl-std=c++ -emit-llvm -pedantic -verify
+// expected-no-diagnostics
+
+#include <opencl_atomic>
+#include <opencl_memory>
+#include <opencl_work_group>
+#include <opencl_work_item>
+using namespace cl;
+
+kernel void worker(global_ptr<uint> input, global_ptr<uint> output, global_ptr<atomic<uint>> tail, global_ptr<float> energy)
+{
+    const uint x = input.get()[get_global_id(0)];
+    const uint n = (x & 1) ? 1 : 0;
+    const uint slot = sub_group_atomic_fetch_add(*tail.get(), n, memory_order_relaxed);
+    if (n)
+        output.get()[slot] = x;
+
+    atomic_ref<float, memory_order_relaxed> total(energy.get()[0]);
+    sub_group_atomic_fetch_add(total, static_cast<float>(x));
+}
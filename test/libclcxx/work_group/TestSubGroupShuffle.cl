@@ -0,0 +1,26 @@
+// RUN: %clang_cc1 %s -triple spir-unknown-unknown -cl-std=c++ -emit-llvm -pedantic -verify
+// expected-no-diagnostics
+
+#define cl_khr_subgroup_shuffle 1
+#define cl_khr_subgroup_shuffle_relative 1
+#define cl_khr_subgroup_ballot 1
+#include <opencl_work_group>
+#include <opencl_work_item>
+using namespace cl;
+
+kernel void worker()
+{
+    uint lane = get_sub_group_local_id();
+    float4 f4 = { 1.0f, 2.0f, 3.0f, 4.0f };
+
+    sub_group_shuffle(int { 1 }, 0u);
+    sub_group_shuffle(f4, lane + 1);
+    sub_group_shuffle_xor(uchar { 1 }, 1u);
+    sub_group_shuffle_xor(f4, 2u);
+    sub_group_shuffle_up(ulong { 1 }, 1u);
+    sub_group_shuffle_up(f4, 1u);
+    sub_group_shuffle_down(short2 { 1, 2 }, 4u);
+
+    uint4 mask = sub_group_ballot(lane % 2 == 0);
+    sub_group_ballot_bit_count(mask);
+}
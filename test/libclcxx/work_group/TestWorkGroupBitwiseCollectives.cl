@@ -0,0 +1,29 @@
+// RUN: %clang_cc1 %s -triple spir-unknown-unknown -cl-std=c++ -emit-llvm -pedantic -verify
+// expected-no-diagnostics
+
+#include <opencl_work_group>
+using namespace cl;
+
+kernel void worker()
+{
+    work_group_reduce<work_group_op::mul>(float { 0.5f });
+    work_group_reduce<work_group_op::bit_and>(uint { 1 });
+    work_group_reduce<work_group_op::bit_or>(ulong { 1 });
+    work_group_scan_inclusive<work_group_op::bit_xor>(int { 1 });
+    work_group_scan_exclusive<work_group_op::logical_and>(int { 1 });
+    work_group_scan_exclusive<work_group_op::logical_or>(long { 1 });
+
+    sub_group_reduce<work_group_op::mul>(int { 2 });
+    sub_group_reduce<work_group_op::bit_or>(uint { 1 });
+    sub_group_scan_inclusive<work_group_op::bit_and>(ulong { 1 });
+    sub_group_scan_exclusive<work_group_op::logical_and>(uint { 1 });
+
+    work_group_reduce(uint { 1 }, bit_or<>());
+    work_group_scan_exclusive(ushort { 1 }, bit_xor<ushort>());
+    sub_group_scan_exclusive(float { 1 }, multiplies<>());
+    sub_group_reduce(int { 1 }, logical_or<>());
+
+    uint4 mask = { 1, 2, 4, 8 };
+    work_group_reduce<work_group_op::bit_or>(mask);
+    sub_group_scan_inclusive<work_group_op::bit_and>(mask);
+}
@@ -0,0 +1,46 @@
+// RUN: %clang_cc1 %s -triple spir-unknown-unknown -cl-std=c++ -emit-llvm -pedantic -verify
+// expected-no-diagnostics
+
+#include <opencl_work_group>
+using namespace cl;
+
+struct arg_min
+{
+    float value;
+    uint index;
+};
+
+struct arg_min_op
+{
+    arg_min operator()(const arg_min &a, const arg_min &b) const { return b.value < a.value ? b : a; }
+};
+
+static_assert(__details::__group_op_identity<minimum<float>, float>::value() == numeric_limits<float>::infinity(), "identity of floating point minimum should be infinity");
+static_assert(__details::__group_op_identity<maximum<>, float>::value() == -numeric_limits<float>::infinity(), "identity of floating point maximum should be negative infinity");
+static_assert(__details::__group_op_identity<minimum<>, int>::value() == numeric_limits<int>::max(), "identity of integer minimum should be the largest value");
+static_assert(__details::__group_op_identity<maximum<int>, int>::value() == numeric_limits<int>::lowest(), "identity of integer maximum should be the lowest value");
+
+kernel void worker()
+{
+    work_group_reduce(int { 1 }, plus<>());
+    work_group_reduce(float { 1 }, minimum<float>());
+    work_group_scan_inclusive(uint { 1 }, maximum<>());
+    work_group_scan_exclusive(ulong { 1 }, plus<ulong>());
+    work_group_scan_exclusive(long { 1 }, long { 5 }, minimum<>());
+
+    work_group_reduce(short { 1 }, plus<short>());
+    work_group_scan_exclusive(short { 1 }, maximum<short>());
+    work_group_scan_exclusive(float { 1 }, minimum<>());
+
+    arg_min a = { 1.0f, 0u };
+    work_group_reduce(a, arg_min_op());
+    work_group_scan_inclusive(a, arg_min_op());
+    work_group_scan_exclusive(a, a, arg_min_op());
+    work_group_reduce(a, [](const arg_min &x, const arg_min &y) { return y.value < x.value ? y : x; });
+
+    sub_group_reduce(int { 1 }, plus<>());
+    sub_group_reduce(a, arg_min_op());
+    sub_group_scan_inclusive(a, arg_min_op());
+    sub_group_scan_exclusive(a, a, arg_min_op());
+    sub_group_scan_exclusive(uchar { 1 }, plus<uchar>());
+}
@@ -0,0 +1,23 @@
+// RUN: %clang_cc1 %s -triple spir-unknown-unknown -cl-std=c++ -emit-llvm -pedantic -verify
+// expected-no-diagnostics
+
+#include <opencl_work_group>
+#include <opencl_work_item>
+using namespace cl;
+
+kernel void worker()
+{
+    bool head = get_local_id(0) % 4 == 0;
+
+    work_group_segmented_scan_inclusive(float { 1.0f }, head, plus<>());
+    work_group_segmented_scan_exclusive(int { 1 }, head, plus<int>());
+    work_group_segmented_scan_exclusive(uint { 1 }, head, uint { 10 }, maximum<>());
+    work_group_segmented_reduce(ulong { 1 }, head, bit_or<>());
+    work_group_segmented_reduce(bool { true }, head, logical_and<>());
+
+    sub_group_segmented_scan_inclusive(short { 1 }, head, minimum<>());
+    sub_group_segmented_scan_exclusive(float { 2.0f }, head, multiplies<>());
+    sub_group_segmented_scan_exclusive(int { 1 }, head, int { 0 }, [](int a, int b) { return a + b; });
+    sub_group_segmented_reduce(long { 1 }, head, plus<>());
+    sub_group_segmented_reduce(bool { false }, head, logical_or<>());
+}
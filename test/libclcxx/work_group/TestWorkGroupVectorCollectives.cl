@@ -0,0 +1,46 @@
+// RUN: %clang_cc1 %s -triple spir-unknown-unknown -cl-std=c++ -emit-llvm -pedantic -verify
+// expected-no-diagnostics
+
+#include <opencl_work_group>
+#include <opencl_vec>
+using namespace cl;
+
+kernel void worker()
+{
+    float4 f4 = { 1.0f, 2.0f, 3.0f, 4.0f };
+    int2 i2 = { 1, 2 };
+    uchar3 uc3 = { 1, 2, 3 };
+
+    work_group_reduce<work_group_op::add>(f4);
+    work_group_reduce<work_group_op::min>(i2);
+    work_group_scan_inclusive<work_group_op::max>(uc3);
+    work_group_scan_exclusive<work_group_op::add>(f4);
+    work_group_scan_exclusive<work_group_op::min>(i2);
+    work_group_broadcast(f4, 0);
+    work_group_broadcast(i2, 0, 1);
+    work_group_broadcast(uc3, 0, 1, 2);
+
+    sub_group_reduce<work_group_op::max>(f4);
+    sub_group_scan_inclusive<work_group_op::add>(i2);
+    sub_group_scan_exclusive<work_group_op::max>(uc3);
+    sub_group_broadcast(f4, 1);
+
+    work_group_reduce(f4, plus<>());
+    work_group_scan_inclusive(i2, minimum<int2>());
+    sub_group_scan_exclusive(uc3, maximum<>());
+
+    vec<float, 4> v4 = f4;
+    work_group_reduce<work_group_op::add>(v4);
+    work_group_scan_exclusive<work_group_op::max>(v4);
+    sub_group_scan_inclusive<work_group_op::min>(v4);
+    work_group_reduce(v4, minimum<>());
+    sub_group_broadcast(v4, 0);
+
+    float16 f16 = 1.0f;
+    int16 i16 = 1;
+    work_group_reduce<work_group_op::add>(f16);
+    work_group_scan_exclusive(f16, f16, plus<>());
+    work_group_scan_inclusive(i16, maximum<>());
+    sub_group_reduce<work_group_op::min>(i16);
+    sub_group_scan_exclusive<work_group_op::add>(f16);
+}